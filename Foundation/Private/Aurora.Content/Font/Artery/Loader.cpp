@@ -45,10 +45,10 @@ namespace Content
         }
 
         // Font Data
-        Graphic::Font::Metrics              FontMetrics;
-        Graphic::Font::Atlas                FontAtlas;
-        Table<UInt32, Graphic::Font::Glyph> FontGlyphs;
-        Table<UInt64, Real32>               FontKerning;
+        Graphic::Font::Metrics                 FontMetrics;
+        Vector<Graphic::Font::Atlas>           FontPages;
+        Vector<Graphic::Font::Glyph>           FontGlyphs;
+        Vector<Graphic::Font::Kerning>         FontKerning;
 
         // Read header
         ArteryFontHeader FontHeader;
@@ -89,23 +89,65 @@ namespace Content
             {
                 Ref<ArteryGlyph> Glyph = Glyphs[Element];
 
-                FontGlyphs.try_emplace(Glyph.Codepoint, Graphic::Font::Glyph {
+                FontGlyphs.emplace_back(Graphic::Font::Glyph {
+                    Glyph.Codepoint,
                     Glyph.Advance.Horizontal,
                     Rectf(Glyph.PlaneBounds.Left, Glyph.PlaneBounds.Top, Glyph.PlaneBounds.Right, Glyph.PlaneBounds.Bottom),
-                    Rectf(Glyph.ImageBounds.Left, Glyph.ImageBounds.Top, Glyph.ImageBounds.Right, Glyph.ImageBounds.Bottom)
+                    Rectf(Glyph.ImageBounds.Left, Glyph.ImageBounds.Top, Glyph.ImageBounds.Right, Glyph.ImageBounds.Bottom),
+                    Glyph.Image,
+                    0,
+                    0
                 });
             }
 
             Ptr<ArteryKernPair> KernPairs;
             ARTERY_FONT_DECODE_READ_PTR(KernPairs, sizeof(ArteryKernPair) * VariantHeader.KernPairCount);
 
-            FontKerning.reserve(VariantHeader.KernPairCount);
-            for (SInt Element = 0; Element < VariantHeader.KernPairCount; ++Element)
+            // Build the kerning table once, sorted by both codepoints so that the pairs each glyph begins are
+            // contiguous and can be searched without hashing.
+            Vector<ArteryKernPair> Pairs(KernPairs, KernPairs + VariantHeader.KernPairCount);
+            Sort(Pairs, [](ConstRef<ArteryKernPair> Left, ConstRef<ArteryKernPair> Right)
             {
-                Ref<ArteryKernPair> KernPair = KernPairs[Element];
+                return Left.Codepoint1 != Right.Codepoint1
+                    ? Left.Codepoint1 < Right.Codepoint1
+                    : Left.Codepoint2 < Right.Codepoint2;
+            });
 
-                FontKerning.try_emplace(
-                    static_cast<UInt64>(KernPair.Codepoint1) << 32 | KernPair.Codepoint2, KernPair.Advance.Horizontal);
+            Sort(FontGlyphs, [](ConstRef<Graphic::Font::Glyph> Left, ConstRef<Graphic::Font::Glyph> Right)
+            {
+                return Left.Codepoint < Right.Codepoint;
+            });
+
+            FontKerning.reserve(Pairs.size());
+
+            for (UInt Element = 0, Glyph = 0; Element < Pairs.size(); ++Element)
+            {
+                ConstRef<ArteryKernPair> Pair = Pairs[Element];
+
+                // Both sequences are sorted, hence the glyph beginning each pair is found by walking forward.
+                while (Glyph < FontGlyphs.size() && FontGlyphs[Glyph].Codepoint < Pair.Codepoint1)
+                {
+                    ++Glyph;
+                }
+
+                if (Glyph == FontGlyphs.size() || FontGlyphs[Glyph].Codepoint != Pair.Codepoint1)
+                {
+                    continue;   // Pair of a glyph the font doesn't have.
+                }
+
+                Ref<Graphic::Font::Glyph> First = FontGlyphs[Glyph];
+
+                if (First.KerningCount == 0)
+                {
+                    First.KerningOffset = FontKerning.size();
+                }
+                else if (FontKerning.back().Codepoint == Pair.Codepoint2)
+                {
+                    continue;   // Duplicated pair, the first one wins.
+                }
+
+                FontKerning.emplace_back(Graphic::Font::Kerning { Pair.Codepoint2, Pair.Advance.Horizontal });
+                ++First.KerningCount;
             }
 
             FontMetrics.Size               = VariantHeader.Metrics[0];
@@ -137,17 +179,30 @@ namespace Content
             Data FontAtlasData(ImageHeader.DataLength);
             std::memcpy(FontAtlasData.GetData(), ImageData, ImageHeader.DataLength);
 
+            // Each image is a page of the atlas, referenced by the glyphs stored in it.
+            Ref<Graphic::Font::Atlas> FontAtlas = FontPages.emplace_back();
             FontAtlas.Bytes  = Move(FontAtlasData);
             FontAtlas.Width  = ImageHeader.Width;
             FontAtlas.Height = ImageHeader.Height;
         }
 
-        // Normalize Glyphs coordinates to use Y-TopLeft instead of Y-BottomLeft
-        const Vector2f AtlasCoordNormalized(1.0f / FontAtlas.Width, 1.0f / FontAtlas.Height);
+        if (FontPages.empty())
+        {
+            Log::Warn("Artery Font: Invalid font without images.");
+            return false;
+        }
 
-        for (auto & Iterator : FontGlyphs)
+        // Normalize Glyphs coordinates to use Y-TopLeft instead of Y-BottomLeft
+        for (Ref<Graphic::Font::Glyph> Element : FontGlyphs)
         {
-            Ref<Graphic::Font::Glyph> Element = Iterator.second;
+            if (Element.Page >= FontPages.size())
+            {
+                Log::Warn("Artery Font: Glyph {} references a missing image.", Element.Codepoint);
+                return false;
+            }
+
+            ConstRef<Graphic::Font::Atlas> FontAtlas = FontPages[Element.Page];
+            const Vector2f AtlasCoordNormalized(1.0f / FontAtlas.Width, 1.0f / FontAtlas.Height);
 
             const Real32 MinY = FontMetrics.Ascender - Element.PlaneBounds.GetTop();
             const Real32 MaxY = MinY + Element.PlaneBounds.GetTop() - Element.PlaneBounds.GetBottom();
@@ -160,7 +215,7 @@ namespace Content
         // Read appendices?
         // Read footer?
 
-        Asset.Load(Move(FontMetrics), Move(FontAtlas), Move(FontGlyphs), Move(FontKerning));
+        Asset.Load(Move(FontMetrics), Move(FontPages), Move(FontGlyphs), Move(FontKerning));
 
         return true;
     }
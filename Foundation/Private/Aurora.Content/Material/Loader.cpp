@@ -24,13 +24,54 @@ namespace Content
 
     Bool MaterialLoader::OnLoad(Ref<Service> Service, Any<Data> File, Ref<Graphic::Material> Asset)
     {
-        TOMLParser        Parser(File.GetText());
+        Summary Summary;
+
+        // Skip parsing the material entirely when an entry for the same source is in the cache.
+        const UInt64 Hash = XXHash64(File.GetSpan<UInt8>(), k_CacheVersion);
+
+        if (Data Cache = Service.FindCache("material", Hash); Cache.HasData())
+        {
+            Reader Archive(Cache.GetSpan<UInt8>());
+            Summary = Archive.ReadObject<MaterialLoader::Summary>();
+        }
+        else
+        {
+            Parse(File.GetText(), Summary);
+
+            Writer Archive;
+            Archive.WriteObject(Summary);
+            Service.SaveCache("material", Hash, Archive.GetData());
+        }
+
+        Asset.SetKind(Summary.Kind);
+
+        for (ConstRef<Binding> Binding : Summary.Bindings)
+        {
+            Asset.SetTexture(Binding.Slot, Service.Require<Graphic::Texture>(Asset, Binding.Path));
+
+            if (Binding.Filtered)
+            {
+                Asset.SetSampler(Binding.Slot, Binding.Sampler);
+            }
+        }
+
+        // TODO: Parameter(s)
+
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void MaterialLoader::Parse(CStr Text, Ref<Summary> Summary)
+    {
+        TOMLParser        Parser(Text);
         const TOMLSection Root     = Parser.GetSection("Material");
         const TOMLSection Textures = Parser.GetSection("Textures");
         const TOMLSection Samplers = Parser.GetSection("Samplers");
 
         // Parse 'properties' section
-        Asset.SetKind(CastEnum(Root.GetString("Kind"), Graphic::Material::Kind::Normal));
+        Summary.Kind = CastEnum(Root.GetString("Kind"), Graphic::Material::Kind::Normal);
 
         // Parse 'textures' section
         for (const Graphic::TextureSlot Slot : ListEnum<Graphic::TextureSlot>())
@@ -38,23 +79,21 @@ namespace Content
             if (const TOMLSection Texture = Textures.GetSection(NameEnum(Slot), false); ! Texture.IsNull())
             {
                 // Parse texture
-                Asset.SetTexture(Slot, Service.Load<Graphic::Texture>(Texture.GetString("Path")));
+                Binding Binding;
+                Binding.Slot = Slot;
+                Binding.Path = Texture.GetString("Path");
 
                 // Parse sampler
                 if (const TOMLSection Sampler = Samplers.GetSection(Texture.GetString("Sampler")); ! Sampler.IsNull())
                 {
-                    Graphic::Sampler Description;
-                    Description.EdgeU  = CastEnum(Sampler.GetString("Edge_U"), Graphic::TextureEdge::Clamp);
-                    Description.EdgeV  = CastEnum(Sampler.GetString("Edge_V"), Graphic::TextureEdge::Clamp);
-                    Description.Filter = CastEnum(Sampler.GetString("Filter"), Graphic::TextureFilter::Nearest);
-
-                    Asset.SetSampler(Slot, Description);
+                    Binding.Filtered       = true;
+                    Binding.Sampler.EdgeU  = CastEnum(Sampler.GetString("Edge_U"), Graphic::TextureEdge::Clamp);
+                    Binding.Sampler.EdgeV  = CastEnum(Sampler.GetString("Edge_V"), Graphic::TextureEdge::Clamp);
+                    Binding.Sampler.Filter = CastEnum(Sampler.GetString("Filter"), Graphic::TextureFilter::Nearest);
                 }
+
+                Summary.Bindings.emplace_back(Move(Binding));
             }
         }
-
-        // TODO: Parameter(s)
-
-        return true;
     }
 }
\ No newline at end of file
@@ -35,5 +35,59 @@ namespace Content
 
         // \see AbstractLoader::Load
         Bool OnLoad(Ref<class Service> Service, Any<Data> File, Ref<Graphic::Material> Asset);
+
+    private:
+
+        // Version of the cached material layout, must be bumped whenever 'Summary' changes.
+        static constexpr UInt64 k_CacheVersion = 1;
+
+        // -=(Undocumented)=-
+        struct Binding
+        {
+            // -=(Undocumented)=-
+            Graphic::TextureSlot Slot     = Graphic::TextureSlot::None;
+
+            // -=(Undocumented)=-
+            SStr                 Path;
+
+            // -=(Undocumented)=-
+            Bool                 Filtered = false;
+
+            // -=(Undocumented)=-
+            Graphic::Sampler     Sampler;
+
+            // -=(Undocumented)=-
+            template<typename Type>
+            void OnSerialize(Stream<Type> Archive)
+            {
+                Archive.SerializeEnum(Slot);
+                Archive.SerializeString8(Path);
+                Archive.SerializeBool(Filtered);
+                Archive.SerializeObject(Sampler);
+            }
+        };
+
+        // -=(Undocumented)=-
+        struct Summary
+        {
+            // -=(Undocumented)=-
+            Graphic::Material::Kind Kind = Graphic::Material::Kind::Normal;
+
+            // -=(Undocumented)=-
+            Vector<Binding>         Bindings;
+
+            // -=(Undocumented)=-
+            template<typename Type>
+            void OnSerialize(Stream<Type> Archive)
+            {
+                Archive.SerializeEnum(Kind);
+                Archive.SerializeVector(Bindings);
+            }
+        };
+
+    private:
+
+        // -=(Undocumented)=-
+        void Parse(CStr Text, Ref<Summary> Summary);
     };
 }
\ No newline at end of file
@@ -0,0 +1,555 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2025 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Document.hpp"
+#include <charconv>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Content
+{
+    // -=(Undocumented)=-
+    static constexpr UInt32 k_Magic        = 0x46546C67;    // 'glTF'
+    static constexpr UInt32 k_Version      = 2;
+    static constexpr UInt32 k_ChunkJSON    = 0x4E4F534A;    // 'JSON'
+    static constexpr UInt32 k_ChunkBinary  = 0x004E4942;    // 'BIN\0'
+
+    // Deepest nesting accepted from the JSON chunk, far more than glTF needs, to keep the parser off the stack's limit.
+    static constexpr UInt32 k_MaxDepth     = 64;
+
+    // A minimal JSON parser over the chunk's text, storing every value in a flat array in document order: the first
+    // child of a value follows it and each value links to its next sibling. Strings reference the text directly.
+    class JSON final
+    {
+    public:
+
+        // -=(Undocumented)=-
+        enum class Kind : UInt8
+        {
+            Null,
+            Boolean,
+            Number,
+            String,
+            Array,
+            Object,
+        };
+
+        // -=(Undocumented)=-
+        struct Node
+        {
+            Kind   Type     = Kind::Null;
+            CStr   Key;
+            CStr   Text;
+            Real64 Number   = 0.0;
+            UInt32 Children = 0;
+            UInt32 Next     = 0;
+        };
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_Root    = 0;
+
+        // Index returned in place of a value that is missing or has another type.
+        static constexpr UInt32 k_Missing = UINT32_MAX;
+
+    public:
+
+        // -=(Undocumented)=-
+        Bool Parse(CStr Text)
+        {
+            mText   = Text;
+            mCursor = 0;
+            mNodes.clear();
+
+            if (! ParseValue(0))
+            {
+                return false;
+            }
+            SkipSpaces();
+            return mCursor == mText.size();
+        }
+
+        // -=(Undocumented)=-
+        ConstRef<Node> operator[](UInt32 Index) const
+        {
+            return mNodes[Index];
+        }
+
+        // Returns the member of an object with the given key and type.
+        UInt32 Find(UInt32 Object, CStr Key, Kind Type) const
+        {
+            if (Object < mNodes.size() && mNodes[Object].Type == Kind::Object)
+            {
+                for (UInt32 Child = Object + 1, Count = 0; Count < mNodes[Object].Children; ++Count)
+                {
+                    if (mNodes[Child].Key == Key)
+                    {
+                        return (mNodes[Child].Type == Type ? Child : k_Missing);
+                    }
+                    Child = mNodes[Child].Next;
+                }
+            }
+            return k_Missing;
+        }
+
+        // Invokes the callback with every element of an array or every member of an object.
+        template<typename Function>
+        void Each(UInt32 Container, Function && Callback) const
+        {
+            if (Container < mNodes.size()
+                && (mNodes[Container].Type == Kind::Array || mNodes[Container].Type == Kind::Object))
+            {
+                for (UInt32 Child = Container + 1, Count = 0; Count < mNodes[Container].Children; ++Count)
+                {
+                    Callback(Child);
+                    Child = mNodes[Child].Next;
+                }
+            }
+        }
+
+        // -=(Undocumented)=-
+        template<typename Type>
+        Type GetNumber(UInt32 Object, CStr Key, Type Default) const
+        {
+            const UInt32 Node = Find(Object, Key, Kind::Number);
+            return (Node != k_Missing ? static_cast<Type>(static_cast<SInt64>(mNodes[Node].Number)) : Default);
+        }
+
+        // -=(Undocumented)=-
+        Bool GetBoolean(UInt32 Object, CStr Key, Bool Default) const
+        {
+            const UInt32 Node = Find(Object, Key, Kind::Boolean);
+            return (Node != k_Missing ? mNodes[Node].Number != 0.0 : Default);
+        }
+
+        // -=(Undocumented)=-
+        CStr GetString(UInt32 Object, CStr Key) const
+        {
+            const UInt32 Node = Find(Object, Key, Kind::String);
+            return (Node != k_Missing ? mNodes[Node].Text : CStr());
+        }
+
+    private:
+
+        // -=(Undocumented)=-
+        void SkipSpaces()
+        {
+            while (mCursor < mText.size() && CStr(" \t\n\r").find(mText[mCursor]) != CStr::npos)
+            {
+                ++mCursor;
+            }
+        }
+
+        // -=(Undocumented)=-
+        Bool Consume(CStr Token)
+        {
+            if (mText.substr(mCursor, Token.size()) == Token)
+            {
+                mCursor += Token.size();
+                return true;
+            }
+            return false;
+        }
+
+        // -=(Undocumented)=-
+        Bool ParseString(Ref<CStr> Output)
+        {
+            if (! Consume("\""))
+            {
+                return false;
+            }
+
+            // Escapes are kept as written, the names glTF stores rarely need them.
+            const UInt Start = mCursor;
+
+            for (; mCursor < mText.size() && mText[mCursor] != '"'; ++mCursor)
+            {
+                if (mText[mCursor] == '\\')
+                {
+                    ++mCursor;
+                }
+            }
+
+            if (mCursor >= mText.size())
+            {
+                return false;
+            }
+            Output = mText.substr(Start, mCursor++ - Start);
+            return true;
+        }
+
+        // -=(Undocumented)=-
+        Bool ParseValue(UInt32 Depth)
+        {
+            SkipSpaces();
+
+            if (mCursor >= mText.size() || Depth > k_MaxDepth)
+            {
+                return false;
+            }
+
+            const UInt32 Index = mNodes.size();
+            mNodes.emplace_back();
+
+            Bool Result = true;
+
+            switch (mText[mCursor])
+            {
+            case '{':
+            case '[':
+            {
+                const Bool   IsObject = (mText[mCursor++] == '{');
+                const Char   Closing  = (IsObject ? '}' : ']');
+                UInt32       Previous = k_Missing;
+
+                mNodes[Index].Type = (IsObject ? Kind::Object : Kind::Array);
+
+                SkipSpaces();
+
+                if (Consume(CStr(& Closing, 1)))
+                {
+                    break;
+                }
+
+                do
+                {
+                    CStr Key;
+
+                    if (IsObject)
+                    {
+                        SkipSpaces();
+
+                        if (! ParseString(Key))
+                        {
+                            return false;
+                        }
+                        SkipSpaces();
+
+                        if (! Consume(":"))
+                        {
+                            return false;
+                        }
+                    }
+
+                    const UInt32 Child = mNodes.size();
+
+                    if (! ParseValue(Depth + 1))
+                    {
+                        return false;
+                    }
+                    mNodes[Child].Key = Key;
+
+                    if (Previous != k_Missing)
+                    {
+                        mNodes[Previous].Next = Child;
+                    }
+                    Previous = Child;
+
+                    ++mNodes[Index].Children;
+                    SkipSpaces();
+                }
+                while (Consume(","));
+
+                Result = Consume(CStr(& Closing, 1));
+                break;
+            }
+            case '"':
+                mNodes[Index].Type = Kind::String;
+                Result = ParseString(mNodes[Index].Text);
+                break;
+            case 't':
+                mNodes[Index].Type   = Kind::Boolean;
+                mNodes[Index].Number = 1.0;
+                Result = Consume("true");
+                break;
+            case 'f':
+                mNodes[Index].Type = Kind::Boolean;
+                Result = Consume("false");
+                break;
+            case 'n':
+                Result = Consume("null");
+                break;
+            default:
+            {
+                const auto [End, Error] = std::from_chars(
+                    mText.data() + mCursor, mText.data() + mText.size(), mNodes[Index].Number);
+
+                mNodes[Index].Type = Kind::Number;
+                mCursor = End - mText.data();
+                Result  = (Error == std::errc());
+                break;
+            }
+            }
+            return Result;
+        }
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        CStr         mText;
+        UInt         mCursor = 0;
+        Vector<Node> mNodes;
+    };
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    template<typename Type>
+    static Type ReadScalar(CPtr<const UInt8> Bytes, UInt Offset)
+    {
+        Type Value;
+        std::memcpy(& Value, Bytes.data() + Offset, sizeof(Type));
+        return Value;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static UInt32 GetComponents(CStr Type)
+    {
+        static const Table<CStr, UInt32> k_Mapping
+        {
+            { "SCALAR", 1 },
+            { "VEC2",   2 },
+            { "VEC3",   3 },
+            { "VEC4",   4 },
+            { "MAT2",   4 },
+            { "MAT3",   9 },
+            { "MAT4",  16 },
+        };
+
+        const auto Iterator = k_Mapping.find(Type);
+        return (Iterator == k_Mapping.end() ? 0 : Iterator->second);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool GLTFDocument::Parse(CPtr<const UInt8> File)
+    {
+        constexpr UInt32 k_HeaderSize = 12;
+        constexpr UInt32 k_ChunkSize  = 8;
+
+        if (File.size() < k_HeaderSize + k_ChunkSize
+            || ReadScalar<UInt32>(File, 0) != k_Magic || ReadScalar<UInt32>(File, 4) != k_Version)
+        {
+            Log::Warn("GLTFLoader: Not a binary glTF 2.0 file");
+            return false;
+        }
+
+        // Walk the chunks, the first must be the JSON one and the binary one (if any) follows it.
+        const UInt Length = Min<UInt>(ReadScalar<UInt32>(File, 8), File.size());
+        CStr       Text;
+
+        for (UInt Offset = k_HeaderSize; Offset + k_ChunkSize <= Length;)
+        {
+            const UInt32 Size = ReadScalar<UInt32>(File, Offset);
+            const UInt32 Type = ReadScalar<UInt32>(File, Offset + 4);
+
+            Offset += k_ChunkSize;
+
+            if (Offset + Size > Length)
+            {
+                Log::Warn("GLTFLoader: Chunk exceeds the size of the file");
+                return false;
+            }
+
+            if (Type == k_ChunkJSON && Text.empty())
+            {
+                Text = CStr(reinterpret_cast<ConstPtr<Char>>(File.data() + Offset), Size);
+            }
+            else if (Type == k_ChunkBinary && mBinary.empty())
+            {
+                mBinary = File.subspan(Offset, Size);
+            }
+            Offset += Align(Size, 4);
+        }
+
+        JSON Document;
+
+        if (Text.empty() || ! Document.Parse(Text))
+        {
+            Log::Warn("GLTFLoader: Malformed JSON chunk");
+            return false;
+        }
+
+        // Only the buffer stored in the binary chunk is supported, as it is the only one a GLB file can reference
+        // without reaching outside of itself.
+        const UInt32 Buffers  = Document.Find(JSON::k_Root, "buffers", JSON::Kind::Array);
+        const Bool   Embedded = (Buffers != JSON::k_Missing && Document[Buffers].Children > 0
+                              && Document.Find(Buffers + 1, "uri", JSON::Kind::String) == JSON::k_Missing);
+
+        Document.Each(Document.Find(JSON::k_Root, "bufferViews", JSON::Kind::Array), [&](UInt32 Node)
+        {
+            View Entry;
+            Entry.Offset = Document.GetNumber<UInt32>(Node, "byteOffset", 0);
+            Entry.Length = Document.GetNumber<UInt32>(Node, "byteLength", 0);
+            Entry.Stride = Document.GetNumber<UInt32>(Node, "byteStride", 0);
+
+            if (Document.GetNumber<UInt32>(Node, "buffer", 0) != 0 || ! Embedded)
+            {
+                Entry.Length = 0;
+            }
+            mViews.push_back(Entry);
+        });
+
+        Document.Each(Document.Find(JSON::k_Root, "accessors", JSON::Kind::Array), [&](UInt32 Node)
+        {
+            Accessor Entry;
+            Entry.View       = Document.GetNumber<SInt32>(Node, "bufferView", -1);
+            Entry.Offset     = Document.GetNumber<UInt32>(Node, "byteOffset", 0);
+            Entry.Count      = Document.GetNumber<UInt32>(Node, "count", 0);
+            Entry.Type       = Document.GetNumber<Component>(Node, "componentType", Component::Float);
+            Entry.Components = GetComponents(Document.GetString(Node, "type"));
+            Entry.Normalized = Document.GetBoolean(Node, "normalized", false);
+            mAccessors.push_back(Entry);
+        });
+
+        Document.Each(Document.Find(JSON::k_Root, "samplers", JSON::Kind::Array), [&](UInt32 Node)
+        {
+            Sampler Entry;
+            Entry.MinFilter = Document.GetNumber<Filter>(Node, "minFilter", Filter::None);
+            Entry.WrapS     = Document.GetNumber<Wrap>(Node, "wrapS", Wrap::Repeat);
+            Entry.WrapT     = Document.GetNumber<Wrap>(Node, "wrapT", Wrap::Repeat);
+            mSamplers.push_back(Entry);
+        });
+
+        Document.Each(Document.Find(JSON::k_Root, "images", JSON::Kind::Array), [&](UInt32 Node)
+        {
+            mImages.push_back({ Document.GetNumber<SInt32>(Node, "bufferView", -1) });
+        });
+
+        Document.Each(Document.Find(JSON::k_Root, "textures", JSON::Kind::Array), [&](UInt32 Node)
+        {
+            Texture Entry;
+            Entry.Name    = Document.GetString(Node, "name");
+            Entry.Sampler = Document.GetNumber<SInt32>(Node, "sampler", -1);
+            Entry.Source  = Document.GetNumber<SInt32>(Node, "source", -1);
+            mTextures.push_back(Move(Entry));
+        });
+
+        Document.Each(Document.Find(JSON::k_Root, "materials", JSON::Kind::Array), [&](UInt32 Node)
+        {
+            const auto GetTexture = [&](UInt32 Parent, CStr Key)
+            {
+                return Document.GetNumber<SInt32>(Document.Find(Parent, Key, JSON::Kind::Object), "index", -1);
+            };
+            const UInt32 PBR = Document.Find(Node, "pbrMetallicRoughness", JSON::Kind::Object);
+
+            Material Entry;
+            Entry.Name      = Document.GetString(Node, "name");
+            Entry.Diffuse   = GetTexture(PBR, "baseColorTexture");
+            Entry.Roughness = GetTexture(PBR, "metallicRoughnessTexture");
+            Entry.Normal    = GetTexture(Node, "normalTexture");
+            Entry.Emissive  = GetTexture(Node, "emissiveTexture");
+            Entry.Occlusion = GetTexture(Node, "occlusionTexture");
+            mMaterials.push_back(Move(Entry));
+        });
+
+        Document.Each(Document.Find(JSON::k_Root, "meshes", JSON::Kind::Array), [&](UInt32 Node)
+        {
+            Mesh Entry;
+            Entry.Name = Document.GetString(Node, "name");
+
+            Document.Each(Document.Find(Node, "primitives", JSON::Kind::Array), [&](UInt32 Child)
+            {
+                Primitive Element;
+                Element.Indices  = Document.GetNumber<SInt32>(Child, "indices", -1);
+                Element.Material = Document.GetNumber<SInt32>(Child, "material", -1);
+                Element.Mode     = Document.GetNumber<UInt32>(Child, "mode", k_ModeTriangles);
+
+                Document.Each(Document.Find(Child, "attributes", JSON::Kind::Object), [&](UInt32 Attribute)
+                {
+                    if (Document[Attribute].Type == JSON::Kind::Number)
+                    {
+                        Element.Attributes.emplace_back(Document[Attribute].Key, Document[Attribute].Number);
+                    }
+                });
+                Entry.Primitives.push_back(Move(Element));
+            });
+            mMeshes.push_back(Move(Entry));
+        });
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    CPtr<const UInt8> GLTFDocument::GetView(SInt32 View) const
+    {
+        if (View < 0 || static_cast<UInt>(View) >= mViews.size())
+        {
+            return CPtr<const UInt8>();
+        }
+
+        ConstRef<GLTFDocument::View> Entry = mViews[View];
+
+        if (static_cast<UInt>(Entry.Offset) + Entry.Length > mBinary.size())
+        {
+            return CPtr<const UInt8>();
+        }
+        return mBinary.subspan(Entry.Offset, Entry.Length);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    CPtr<const UInt8> GLTFDocument::GetData(ConstRef<Accessor> Accessor) const
+    {
+        const CPtr<const UInt8> Bytes  = GetView(Accessor.View);
+        const UInt              Size   = GetComponentSize(Accessor.Type) * Accessor.Components;
+        const UInt              Stride = GetStride(Accessor);
+        const UInt              Extent = (Accessor.Count > 0 ? static_cast<UInt>(Accessor.Count - 1) * Stride + Size : 0);
+
+        if (Bytes.empty() || Size == 0 || Accessor.Offset > Bytes.size() || Extent > Bytes.size() - Accessor.Offset)
+        {
+            return CPtr<const UInt8>();
+        }
+        return Bytes.subspan(Accessor.Offset, Extent);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt32 GLTFDocument::GetStride(ConstRef<Accessor> Accessor) const
+    {
+        if (Accessor.View >= 0 && static_cast<UInt>(Accessor.View) < mViews.size() && mViews[Accessor.View].Stride > 0)
+        {
+            return mViews[Accessor.View].Stride;
+        }
+        return GetComponentSize(Accessor.Type) * Accessor.Components;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt32 GLTFDocument::GetComponentSize(Component Type)
+    {
+        switch (Type)
+        {
+        case Component::Byte:
+        case Component::UnsignedByte:
+            return 1;
+        case Component::Short:
+        case Component::UnsignedShort:
+            return 2;
+        case Component::UnsignedInt:
+        case Component::Float:
+            return 4;
+        default:
+            return 0;
+        }
+    }
+}
\ No newline at end of file
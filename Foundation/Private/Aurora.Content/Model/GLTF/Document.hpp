@@ -0,0 +1,200 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2025 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Aurora.Base/Base.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Content
+{
+    // A binary glTF (GLB) container parsed in place: the JSON chunk is parsed into the few descriptions the engine
+    // consumes, and every buffer view references the binary chunk of the source file, which must therefore outlive
+    // the document.
+    class GLTFDocument final
+    {
+    public:
+
+        // -=(Undocumented)=-
+        enum class Component : UInt32
+        {
+            Byte          = 5120,
+            UnsignedByte  = 5121,
+            Short         = 5122,
+            UnsignedShort = 5123,
+            UnsignedInt   = 5125,
+            Float         = 5126,
+        };
+
+        // -=(Undocumented)=-
+        enum class Filter : UInt32
+        {
+            None                 = 0,
+            Nearest              = 9728,
+            Linear               = 9729,
+            NearestMipmapNearest = 9984,
+            LinearMipmapNearest  = 9985,
+            NearestMipmapLinear  = 9986,
+            LinearMipmapLinear   = 9987,
+        };
+
+        // -=(Undocumented)=-
+        enum class Wrap : UInt32
+        {
+            Repeat = 10497,
+            Clamp  = 33071,
+            Mirror = 33648,
+        };
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_ModeTriangles = 4;
+
+        // -=(Undocumented)=-
+        struct View
+        {
+            UInt32 Offset = 0;
+            UInt32 Length = 0;
+            UInt32 Stride = 0;
+        };
+
+        // -=(Undocumented)=-
+        struct Accessor
+        {
+            SInt32    View       = -1;
+            UInt32    Offset     = 0;
+            UInt32    Count      = 0;
+            Component Type       = Component::Float;
+            UInt32    Components = 1;
+            Bool      Normalized = false;
+        };
+
+        // -=(Undocumented)=-
+        struct Sampler
+        {
+            Filter MinFilter = Filter::None;
+            Wrap   WrapS     = Wrap::Repeat;
+            Wrap   WrapT     = Wrap::Repeat;
+        };
+
+        // -=(Undocumented)=-
+        struct Image
+        {
+            SInt32 View = -1;
+        };
+
+        // -=(Undocumented)=-
+        struct Texture
+        {
+            SStr   Name;
+            SInt32 Sampler = -1;
+            SInt32 Source  = -1;
+        };
+
+        // -=(Undocumented)=-
+        struct Material
+        {
+            SStr   Name;
+            SInt32 Diffuse   = -1;
+            SInt32 Roughness = -1;
+            SInt32 Normal    = -1;
+            SInt32 Emissive  = -1;
+            SInt32 Occlusion = -1;
+        };
+
+        // -=(Undocumented)=-
+        struct Primitive
+        {
+            Vector<std::pair<SStr, SInt32>> Attributes;
+            SInt32                          Indices  = -1;
+            SInt32                          Material = -1;
+            UInt32                          Mode     = k_ModeTriangles;
+        };
+
+        // -=(Undocumented)=-
+        struct Mesh
+        {
+            SStr              Name;
+            Vector<Primitive> Primitives;
+        };
+
+    public:
+
+        // Parses the container, returns false (and logs why) when it is malformed or not a GLB file.
+        Bool Parse(CPtr<const UInt8> File);
+
+        // Returns the bytes of a buffer view, or an empty span when the view doesn't exist.
+        CPtr<const UInt8> GetView(SInt32 View) const;
+
+        // Returns the bytes an accessor spans starting at its first element, or an empty span when any of its elements
+        // is out of the bounds of its view. Elements are 'GetStride' bytes apart.
+        CPtr<const UInt8> GetData(ConstRef<Accessor> Accessor) const;
+
+        // -=(Undocumented)=-
+        UInt32 GetStride(ConstRef<Accessor> Accessor) const;
+
+        // -=(Undocumented)=-
+        ConstRef<Vector<Accessor>> GetAccessors() const
+        {
+            return mAccessors;
+        }
+
+        // -=(Undocumented)=-
+        ConstRef<Vector<Sampler>> GetSamplers() const
+        {
+            return mSamplers;
+        }
+
+        // -=(Undocumented)=-
+        ConstRef<Vector<Image>> GetImages() const
+        {
+            return mImages;
+        }
+
+        // -=(Undocumented)=-
+        ConstRef<Vector<Texture>> GetTextures() const
+        {
+            return mTextures;
+        }
+
+        // -=(Undocumented)=-
+        ConstRef<Vector<Material>> GetMaterials() const
+        {
+            return mMaterials;
+        }
+
+        // -=(Undocumented)=-
+        ConstRef<Vector<Mesh>> GetMeshes() const
+        {
+            return mMeshes;
+        }
+
+        // Returns the size in bytes of a single component.
+        static UInt32 GetComponentSize(Component Type);
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        CPtr<const UInt8> mBinary;
+        Vector<View>      mViews;
+        Vector<Accessor>  mAccessors;
+        Vector<Sampler>   mSamplers;
+        Vector<Image>     mImages;
+        Vector<Texture>   mTextures;
+        Vector<Material>  mMaterials;
+        Vector<Mesh>      mMeshes;
+    };
+}
\ No newline at end of file
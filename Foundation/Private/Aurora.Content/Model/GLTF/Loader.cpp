@@ -11,10 +11,11 @@
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
 #include "Loader.hpp"
-#define TINYGLTF_IMPLEMENTATION
-#define TINYGLTF_NO_STB_IMAGE_WRITE
-#include <tiny_gltf.h>
+#include "Document.hpp"
 #include <Aurora.Content/Service.hpp>
+#include <Aurora.Content/Texture/STB/Loader.hpp>
+#include <Aurora.Graphic/Optimizer.hpp>
+#include <Aurora.Graphic/Simplifier.hpp>
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 // [   CODE   ]
@@ -46,47 +47,47 @@ namespace Content
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-    Graphic::Sampler LoadSampler(ConstRef<tinygltf::Sampler> GLTFSampler)
+    Graphic::Sampler LoadSampler(ConstRef<GLTFDocument::Sampler> GLTFSampler)
     {
         Graphic::TextureEdge   EdgeU  = Graphic::TextureEdge::Repeat;
         Graphic::TextureEdge   EdgeV  = Graphic::TextureEdge::Repeat;
         Graphic::TextureFilter Filter = Graphic::TextureFilter::Nearest;
 
-        switch (GLTFSampler.wrapS)
+        switch (GLTFSampler.WrapS)
         {
-        case TINYGLTF_TEXTURE_WRAP_CLAMP_TO_EDGE:
+        case GLTFDocument::Wrap::Clamp:
             EdgeU = Graphic::TextureEdge::Clamp;
             break;
-        case TINYGLTF_TEXTURE_WRAP_MIRRORED_REPEAT:
+        case GLTFDocument::Wrap::Mirror:
             EdgeU = Graphic::TextureEdge::Mirror;
             break;
         default:
             break;
         }
-        switch (GLTFSampler.wrapT)
+        switch (GLTFSampler.WrapT)
         {
-        case TINYGLTF_TEXTURE_WRAP_CLAMP_TO_EDGE:
+        case GLTFDocument::Wrap::Clamp:
             EdgeV = Graphic::TextureEdge::Clamp;
             break;
-        case TINYGLTF_TEXTURE_WRAP_MIRRORED_REPEAT:
+        case GLTFDocument::Wrap::Mirror:
             EdgeV = Graphic::TextureEdge::Mirror;
             break;
         default:
             break;
         }
 
-        switch (GLTFSampler.minFilter)
+        switch (GLTFSampler.MinFilter)
         {
-        case TINYGLTF_TEXTURE_FILTER_NEAREST:
-        case TINYGLTF_TEXTURE_FILTER_NEAREST_MIPMAP_NEAREST:    // @NOT_SUPPORTED
-        case TINYGLTF_TEXTURE_FILTER_NEAREST_MIPMAP_LINEAR:     // @NOT_SUPPORTED
+        case GLTFDocument::Filter::Nearest:
+        case GLTFDocument::Filter::NearestMipmapNearest:        // @NOT_SUPPORTED
+        case GLTFDocument::Filter::NearestMipmapLinear:         // @NOT_SUPPORTED
             Filter = Graphic::TextureFilter::Nearest;
             break;
-        case TINYGLTF_TEXTURE_FILTER_LINEAR:
-        case TINYGLTF_TEXTURE_FILTER_LINEAR_MIPMAP_NEAREST:     // @NOT_SUPPORTED
+        case GLTFDocument::Filter::Linear:
+        case GLTFDocument::Filter::LinearMipmapNearest:         // @NOT_SUPPORTED
             Filter = Graphic::TextureFilter::Bilinear;
             break;
-        case TINYGLTF_TEXTURE_FILTER_LINEAR_MIPMAP_LINEAR:
+        case GLTFDocument::Filter::LinearMipmapLinear:
              Filter = Graphic::TextureFilter::Trilinear;
             break;
         default:
@@ -98,189 +99,849 @@ namespace Content
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-    SPtr<Graphic::Texture> LoadTexture(Ref<tinygltf::Model> GLTFModel, ConstRef<tinygltf::Texture> GLTFTexture)
+    struct Channel
     {
-        ConstRef<tinygltf::Image> GLTFImage = GLTFModel.images[GLTFTexture.source];
+        Graphic::VertexSemantic Semantic;
+        Graphic::VertexFormat   Format;
+        UInt32                  Stride;
+        CPtr<const UInt8>       Bytes;
+        Vector<UInt8>           Storage;
+    };
 
-        Data Chunk(GLTFImage.image.size());
-        Chunk.Copy(GLTFImage.image.data(), GLTFImage.image.size());
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-        constexpr UInt8 k_DefaultMipmaps = 1;
-        constexpr UInt8 k_DefaultSamples = 1;
+    Bool GetFormat(GLTFDocument::Component Component, UInt32 Count, Bool Normalized, Ref<Graphic::VertexFormat> Format)
+    {
+        switch (Component)
+        {
+        case GLTFDocument::Component::Float:
+            if (Count >= 1 && Count <= 4)
+            {
+                Format = static_cast<Graphic::VertexFormat>(CastEnum(Graphic::VertexFormat::Float32x1) + Count - 1);
+                return true;
+            }
+            break;
+        case GLTFDocument::Component::Byte:
+            if (Count == 4)
+            {
+                Format = Normalized ? Graphic::VertexFormat::SIntNorm8x4 : Graphic::VertexFormat::SInt8x4;
+                return true;
+            }
+            break;
+        case GLTFDocument::Component::UnsignedByte:
+            if (Count == 4)
+            {
+                Format = Normalized ? Graphic::VertexFormat::UIntNorm8x4 : Graphic::VertexFormat::UInt8x4;
+                return true;
+            }
+            break;
+        case GLTFDocument::Component::Short:
+            if (Count == 2)
+            {
+                Format = Normalized ? Graphic::VertexFormat::SIntNorm16x2 : Graphic::VertexFormat::SInt16x2;
+                return true;
+            }
+            if (Count == 4)
+            {
+                Format = Normalized ? Graphic::VertexFormat::SIntNorm16x4 : Graphic::VertexFormat::SInt16x4;
+                return true;
+            }
+            break;
+        case GLTFDocument::Component::UnsignedShort:
+            if (Count == 2)
+            {
+                Format = Normalized ? Graphic::VertexFormat::UIntNorm16x2 : Graphic::VertexFormat::UInt16x2;
+                return true;
+            }
+            if (Count == 4)
+            {
+                Format = Normalized ? Graphic::VertexFormat::UIntNorm16x4 : Graphic::VertexFormat::UInt16x4;
+                return true;
+            }
+            break;
+        default:
+            break;
+        }
+        return false;
+    }
 
-        const SPtr<Graphic::Texture> Texture = NewPtr<Graphic::Texture>(Uri { GLTFTexture.name });
-        Texture->Load(
-            Graphic::TextureFormat::RGBA8UIntNorm,
-            Graphic::TextureLayout::Source, GLTFImage.width, GLTFImage.height, k_DefaultMipmaps, k_DefaultSamples, Move(Chunk));
-        return Texture;
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    template<typename Type>
+    Type ReadScalar(ConstPtr<UInt8> Address)
+    {
+        Type Value;
+        std::memcpy(& Value, Address, sizeof(Type));
+        return Value;
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-    Bool GLTFLoader::OnLoad(Ref<Service> Service, Any<Data> File, Ref<Graphic::Model> Asset)
+    Real32 ReadComponent(ConstPtr<UInt8> Address, GLTFDocument::Component Component, Bool Normalized)
     {
-        tinygltf::TinyGLTF GLTFLoader;
-        tinygltf::Model    GLTFModel;
+        switch (Component)
+        {
+        case GLTFDocument::Component::Float:
+            return ReadScalar<Real32>(Address);
+        case GLTFDocument::Component::Byte:
+        {
+            const Real32 Value = ReadScalar<SInt8>(Address);
+            return Normalized ? Max(Value / 127.0f, -1.0f) : Value;
+        }
+        case GLTFDocument::Component::UnsignedByte:
+        {
+            const Real32 Value = ReadScalar<UInt8>(Address);
+            return Normalized ? Value / 255.0f : Value;
+        }
+        case GLTFDocument::Component::Short:
+        {
+            const Real32 Value = ReadScalar<SInt16>(Address);
+            return Normalized ? Max(Value / 32767.0f, -1.0f) : Value;
+        }
+        case GLTFDocument::Component::UnsignedShort:
+        {
+            const Real32 Value = ReadScalar<UInt16>(Address);
+            return Normalized ? Value / 65535.0f : Value;
+        }
+        case GLTFDocument::Component::UnsignedInt:
+            return static_cast<Real32>(ReadScalar<UInt32>(Address));
+        default:
+            return 0.0f;
+        }
+    }
 
-        // Parse the model asset using TinyGLTF
-        SStr Error;
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-        const Bool Result = GLTFLoader.LoadBinaryFromMemory(
-            AddressOf(GLTFModel), AddressOf(Error), nullptr, File.GetData<UInt8>(), File.GetSize());
-        if (!Result)
+    Bool ReadChannel(ConstRef<GLTFDocument> Document, ConstRef<GLTFDocument::Accessor> Accessor, Ref<Channel> Output)
+    {
+        const UInt32 Components = Accessor.Components;
+        const UInt32 Size       = GLTFDocument::GetComponentSize(Accessor.Type);
+
+        if (Components < 1 || Components > 4 || Size < 1)
         {
-            Log::Warn("GLTFLoader: {}", Error);
             return false;
         }
 
-        // Safe-guard against big model(s).
-        if (GLTFModel.meshes.size() > Graphic::Mesh::k_MaxPrimitives)
+        // Keep the layout of the source when the device can fetch it as is, otherwise widen it to floats.
+        const Bool Widen = ! GetFormat(Accessor.Type, Components, Accessor.Normalized, Output.Format);
+
+        if (Widen)
+        {
+            GetFormat(GLTFDocument::Component::Float, Components, false, Output.Format);
+        }
+        Output.Stride = Components * (Widen ? sizeof(Real32) : Size);
+
+        // Accessors without a view are defined as zero-filled.
+        if (Accessor.View < 0)
+        {
+            Output.Storage.assign(Accessor.Count * Output.Stride, 0);
+            Output.Bytes = Output.Storage;
+            return true;
+        }
+
+        const CPtr<const UInt8> Source = Document.GetData(Accessor);
+        const UInt32            Pitch  = Document.GetStride(Accessor);
+
+        if (Source.empty() && Accessor.Count > 0)
         {
-            Log::Warn("GLTFLoader: Exceeding maximum sub-mesh support of {} with {}",
-                Graphic::Mesh::k_MaxPrimitives, GLTFModel.meshes.size());
             return false;
         }
 
-        // Find how many bytes we need for buffer(s) and create them
-        UInt32 BytesForVertices = 0;
-        UInt32 BytesForIndices  = 0;
-        for (ConstRef<tinygltf::BufferView> View : GLTFModel.bufferViews)
+        // Tightly packed attributes the device can fetch are referenced straight from the file, only the ones
+        // that are interleaved or need widening are copied.
+        if (! Widen && Pitch == Output.Stride)
+        {
+            Output.Bytes = Source.subspan(0, Accessor.Count * Output.Stride);
+            return true;
+        }
+
+        Output.Storage.resize(Accessor.Count * Output.Stride);
+
+        for (UInt32 Element = 0; Element < Accessor.Count; ++Element)
         {
-            if (View.target == TINYGLTF_TARGET_ARRAY_BUFFER)
+            const ConstPtr<UInt8> Address     = Source.data() + Element * Pitch;
+            const Ptr<UInt8>      Destination = Output.Storage.data() + Element * Output.Stride;
+
+            if (Widen)
             {
-                BytesForVertices += View.byteLength;
+                for (UInt32 Component = 0; Component < Components; ++Component)
+                {
+                    const Real32 Value = ReadComponent(Address + Component * Size, Accessor.Type, Accessor.Normalized);
+                    std::memcpy(Destination + Component * sizeof(Real32), & Value, sizeof(Real32));
+                }
             }
             else
             {
-                BytesForIndices += View.byteLength;
+                std::memcpy(Destination, Address, Output.Stride);
             }
         }
+        Output.Bytes = Output.Storage;
+        return true;
+    }
 
-        UInt32 OffsetForVertices = 0;
-        UInt32 OffsetForIndices  = 0;
-        Data   BlockForVertices(BytesForVertices);
-        Data   BlockForIndices(BytesForIndices);
-        for (Ref<tinygltf::BufferView> View : GLTFModel.bufferViews)
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool ReadIndices(ConstRef<GLTFDocument> Document, ConstRef<GLTFDocument::Accessor> Accessor,
+        Ref<Vector<UInt32>> Output)
+    {
+        const CPtr<const UInt8> Source = Document.GetData(Accessor);
+        const UInt32            Pitch  = Document.GetStride(Accessor);
+
+        if (Accessor.View < 0 || Accessor.Components != 1 || (Source.empty() && Accessor.Count > 0))
         {
-            if (View.target == TINYGLTF_TARGET_ARRAY_BUFFER)
+            return false;
+        }
+
+        Output.resize(Accessor.Count);
+
+        for (UInt32 Element = 0; Element < Accessor.Count; ++Element)
+        {
+            const ConstPtr<UInt8> Address = Source.data() + Element * Pitch;
+
+            switch (Accessor.Type)
             {
-                memcpy(
-                    BlockForVertices.GetData<UInt8>() + OffsetForVertices,
-                    AddressOf(GLTFModel.buffers[View.buffer].data[View.byteOffset]), View.byteLength);
-                View.byteOffset = OffsetForVertices;
-                OffsetForVertices += View.byteLength;
+            case GLTFDocument::Component::UnsignedByte:
+                Output[Element] = ReadScalar<UInt8>(Address);
+                break;
+            case GLTFDocument::Component::UnsignedShort:
+                Output[Element] = ReadScalar<UInt16>(Address);
+                break;
+            case GLTFDocument::Component::UnsignedInt:
+                Output[Element] = ReadScalar<UInt32>(Address);
+                break;
+            default:
+                return false;
             }
-            else
+        }
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Quantize(Ref<Channel> Input, UInt32 Vertices)
+    {
+        const Bool IsDirection = (Input.Semantic == Graphic::VertexSemantic::Normal
+                               || Input.Semantic == Graphic::VertexSemantic::Tangent);
+        const Bool IsTexCoord  = (Input.Semantic >= Graphic::VertexSemantic::TexCoord0
+                               && Input.Semantic <= Graphic::VertexSemantic::TexCoord7);
+        const Bool IsFloat     = (Input.Format == Graphic::VertexFormat::Float32x3
+                               || Input.Format == Graphic::VertexFormat::Float32x4);
+
+        // Unit vectors lose nothing visible as 16-bit signed normalized, the unused fourth lane keeps the
+        // attribute 4-byte aligned.
+        if (IsDirection && IsFloat)
+        {
+            const UInt32  Components = (Input.Format == Graphic::VertexFormat::Float32x3 ? 3 : 4);
+            Vector<UInt8> Bytes(Vertices * sizeof(SInt16) * 4);
+
+            for (UInt32 Vertex = 0; Vertex < Vertices; ++Vertex)
             {
-                memcpy(
-                     BlockForIndices.GetData<UInt8>() + OffsetForIndices,
-                     AddressOf(GLTFModel.buffers[View.buffer].data[View.byteOffset]), View.byteLength);
-                View.byteOffset = OffsetForIndices;
-                OffsetForIndices += View.byteLength;
+                SInt16 Packed[4] = { 0, 0, 0, 0 };
+
+                for (UInt32 Component = 0; Component < Components; ++Component)
+                {
+                    Packed[Component] = Graphic::QuantizeSNorm16(
+                        ReadScalar<Real32>(Input.Bytes.data() + Vertex * Input.Stride + Component * sizeof(Real32)));
+                }
+                std::memcpy(Bytes.data() + Vertex * sizeof(Packed), Packed, sizeof(Packed));
             }
+
+            Input.Format = Graphic::VertexFormat::SIntNorm16x4;
+            Input.Stride  = sizeof(SInt16) * 4;
+            Input.Storage = Move(Bytes);
+            Input.Bytes   = Input.Storage;
         }
+        else if (IsTexCoord && Input.Format == Graphic::VertexFormat::Float32x2)
+        {
+            Vector<UInt8> Bytes(Vertices * sizeof(UInt16) * 2);
 
-        // Parse each material from the model
-        Array<SPtr<Graphic::Material>, Graphic::Mesh::k_MaxPrimitives> Materials { };
-        for (UInt32 ID = 0; ConstRef<tinygltf::Material> GLTFMaterial : GLTFModel.materials)
+            for (UInt32 Vertex = 0; Vertex < Vertices; ++Vertex)
+            {
+                const ConstPtr<UInt8> Source    = Input.Bytes.data() + Vertex * Input.Stride;
+                const UInt16          Packed[2] = {
+                    Graphic::QuantizeHalf(ReadScalar<Real32>(Source)),
+                    Graphic::QuantizeHalf(ReadScalar<Real32>(Source + sizeof(Real32)))
+                };
+                std::memcpy(Bytes.data() + Vertex * sizeof(Packed), Packed, sizeof(Packed));
+            }
+
+            Input.Format = Graphic::VertexFormat::Float16x2;
+            Input.Stride  = sizeof(UInt16) * 2;
+            Input.Storage = Move(Bytes);
+            Input.Bytes   = Input.Storage;
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt32 Optimize(Ref<Vector<Channel>> Channels, Ref<Vector<UInt32>> Indices, UInt32 Vertices, Real32 Threshold)
+    {
+        Vector<UInt32> Remap(Vertices);
+
+        // Moves every channel into the order given by the remap table, dropping the vertices left unreferenced.
+        const auto Apply = [&](UInt32 Count)
         {
-            const SPtr<Graphic::Material> Material = NewPtr<Graphic::Material>(Uri { GLTFMaterial.name });
-            Material->SetExclusive(true);
+            Graphic::RemapIndices(Indices, Remap);
 
-            if (SInt32 Index = GLTFMaterial.pbrMetallicRoughness.baseColorTexture.index; Index >= 0)
+            for (Ref<Channel> Input : Channels)
             {
-                ConstRef<tinygltf::Texture> GLTFTexture = GLTFModel.textures[Index];
+                Vector<UInt8> Bytes(Count * Input.Stride);
+                Graphic::RemapVertices(Bytes, { Input.Bytes, Input.Stride }, Remap);
+                Input.Storage = Move(Bytes);
+                Input.Bytes   = Input.Storage;
+            }
+            Remap.resize(Count);
+        };
+
+        // Merge the vertices that are identical on every channel, exporters often split them per face.
+        Vector<Graphic::VertexStream> Views;
+
+        for (ConstRef<Channel> Input : Channels)
+        {
+            Views.push_back({ Input.Bytes, Input.Stride });
+        }
+        Vertices = Graphic::GenerateVertexRemap(Remap, Indices, Views);
+        Apply(Vertices);
+
+        // Sort the triangles for the post-transform cache, then sort the resulting clusters front to back
+        // as long as it doesn't cost more than the threshold in cache misses.
+        Graphic::OptimizeVertexCache(Indices, Vertices);
+
+        const auto Position = std::ranges::find(Channels, Graphic::VertexSemantic::Position, & Channel::Semantic);
+
+        if (Position != Channels.end() && Position->Format == Graphic::VertexFormat::Float32x3)
+        {
+            Graphic::OptimizeOverdraw(Indices, { Position->Bytes, Position->Stride }, Threshold);
+        }
+
+        // Lay the vertices out in the order they are first fetched.
+        Vertices = Graphic::GenerateFetchRemap(Remap, Indices);
+        Apply(Vertices);
+
+        return Vertices;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool GetBounds(ConstRef<Vector<Channel>> Channels, UInt32 Vertices, Ref<Vector3f> Minimum, Ref<Vector3f> Maximum)
+    {
+        const auto Position = std::ranges::find(Channels, Graphic::VertexSemantic::Position, & Channel::Semantic);
+
+        if (Position == Channels.end() || Position->Format != Graphic::VertexFormat::Float32x3 || Vertices == 0)
+        {
+            return false;
+        }
+
+        for (UInt32 Vertex = 0; Vertex < Vertices; ++Vertex)
+        {
+            const ConstPtr<UInt8> Source = Position->Bytes.data() + Vertex * Position->Stride;
+            const Vector3f        Point(
+                ReadScalar<Real32>(Source),
+                ReadScalar<Real32>(Source + sizeof(Real32)),
+                ReadScalar<Real32>(Source + sizeof(Real32) * 2));
+
+            Minimum = (Vertex == 0 ? Point : Vector3f::Min(Minimum, Point));
+            Maximum = (Vertex == 0 ? Point : Vector3f::Max(Maximum, Point));
+        }
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    struct Detail
+    {
+        Vector<UInt32> Indices;
+        Real32         Error;
+    };
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Vector<Detail> Simplify(ConstRef<Vector<Channel>> Channels, ConstRef<Vector<UInt32>> Indices, UInt32 Vertices,
+        Real32 Extent, UInt32 Levels, Real32 Reduction, Real32 Deviation)
+    {
+        Vector<Detail> Details;
+
+        const auto Position = std::ranges::find(Channels, Graphic::VertexSemantic::Position, & Channel::Semantic);
+
+        if (Position == Channels.end() || Position->Format != Graphic::VertexFormat::Float32x3)
+        {
+            return Details;
+        }
+
+        // Every level is simplified from the full-detail triangles, so its error is measured against the original
+        // surface instead of accumulating over the previous level.
+        Real32 Target = Indices.size();
 
-                Material->SetTexture(Graphic::TextureSlot::Diffuse, LoadTexture(GLTFModel, GLTFTexture));
-                Material->SetSampler(Graphic::TextureSlot::Diffuse, LoadSampler(GLTFModel.samplers[GLTFTexture.sampler]));
+        for (UInt32 Level = 0; Level < Levels; ++Level)
+        {
+            Target *= Reduction;
+
+            Detail Entry;
+            Entry.Indices.resize(Indices.size());
+
+            const UInt32 Count = Graphic::Simplify(Entry.Indices, Indices, { Position->Bytes, Position->Stride },
+                static_cast<UInt32>(Target) / 3 * 3, Extent * Deviation, Entry.Error);
+
+            // Stop once a level no longer saves enough triangles to be worth its indices.
+            const UInt32 Previous = (Details.empty() ? Indices.size() : Details.back().Indices.size());
+
+            if (Count == 0 || Count * 10 > Previous * 9)
+            {
+                break;
             }
-            if (SInt32 Index = GLTFMaterial.pbrMetallicRoughness.metallicRoughnessTexture.index; Index >= 0)
+
+            Entry.Indices.resize(Count);
+            Graphic::OptimizeVertexCache(Entry.Indices, Vertices);
+
+            Details.emplace_back(Move(Entry));
+        }
+        return Details;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool GLTFLoader::OnLoad(Ref<Service> Service, Any<Data> File, Ref<Graphic::Model> Asset)
+    {
+        const Options Settings = ReadOptions(Service, Asset);
+
+        // Skip parsing the model (and decoding its embedded images) entirely when an entry for the same
+        // source and options is in the cache.
+        const UInt8  Flags[] = {
+            Settings.Optimize,
+            Settings.Quantize,
+            static_cast<UInt8>(Settings.Overdraw * 100.0f),
+            Settings.Levels,
+            static_cast<UInt8>(Settings.Reduction * 100.0f),
+            static_cast<UInt8>(Settings.Deviation * 1000.0f)
+        };
+        const UInt64 Hash = XXHash64(Flags, XXHash64(File.GetSpan<UInt8>(), k_CacheVersion));
+
+        if (Data Cache = Service.FindCache("model", Hash); Cache.HasData())
+        {
+            Reader Archive(Cache.GetSpan<UInt8>());
+            return Build(Archive, Asset);
+        }
+
+        Writer Archive(File.GetSize());
+
+        if (! Decode(Service, File, Settings, Archive))
+        {
+            return false;
+        }
+        Service.SaveCache("model", Hash, Archive.GetData());
+
+        Reader Input(Archive.GetData());
+        return Build(Input, Asset);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    GLTFLoader::Options GLTFLoader::ReadOptions(Ref<class Service> Service, Ref<Resource> Asset) const
+    {
+        ConstRef<Uri> Key = Asset.GetKey();
+        Options       Settings;
+
+        if (const Data Sidecar = Service.Read(Asset, Format("{}{}", Key.GetUrlWithoutFragment(), k_Sidecar)); Sidecar.HasData())
+        {
+            TOMLParser        Parser(Sidecar.GetText());
+            const TOMLSection Model = Parser.GetSection("Model");
+
+            Settings.Optimize = Model.GetBool("Optimize", Settings.Optimize);
+            Settings.Quantize = Model.GetBool("Quantize", Settings.Quantize);
+            Settings.Overdraw = Clamp<Real32>(Model.GetReal("Overdraw", Settings.Overdraw), 1.0f, 2.0f);
+
+            Settings.Levels    = Clamp<SInt>(Model.GetNumber("Levels", Settings.Levels), 0, Graphic::Mesh::k_MaxLevels - 1);
+            Settings.Reduction = Clamp<Real32>(Model.GetReal("Reduction", Settings.Reduction), 0.05f, 0.95f);
+            Settings.Deviation = Clamp<Real32>(Model.GetReal("Deviation", Settings.Deviation), 0.0f, 0.25f);
+        }
+        return Settings;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool GLTFLoader::Decode(Ref<class Service> Service, ConstRef<Data> File, ConstRef<Options> Settings, Ref<Writer> Archive)
+    {
+        // Parse the container in place, every accessor and image references the binary chunk of the file.
+        GLTFDocument Document;
+
+        if (! Document.Parse(File.GetSpan<UInt8>()))
+        {
+            return false;
+        }
+
+        ConstRef<Vector<GLTFDocument::Accessor>> Accessors = Document.GetAccessors();
+        ConstRef<Vector<GLTFDocument::Mesh>>     Meshes    = Document.GetMeshes();
+        ConstRef<Vector<GLTFDocument::Material>> Materials = Document.GetMaterials();
+
+        // Safe-guard against more materials than a primitive can reference.
+        if (Materials.size() > INT16_MAX)
+        {
+            Log::Warn("GLTFLoader: Exceeding maximum material support of {} with {}", INT16_MAX, Materials.size());
+            return false;
+        }
+
+        // Parse each mesh from the model into tightly packed streams, the streams are only written to the archive
+        // once every offset is known so that the ones referencing the file are never copied twice.
+        Vector<Channel>                  Streams;
+        UInt32                           BlockForVerticesSize = 0;
+        Vector<UInt8>                    BlockForIndices;
+        Vector<Graphic::Mesh::Primitive> Primitives;
+
+        for (ConstRef<GLTFDocument::Mesh> GLTFMesh : Meshes)
+        {
+            for (ConstRef<GLTFDocument::Primitive> GLTFPrimitive : GLTFMesh.Primitives)
             {
-                ConstRef<tinygltf::Texture> GLTFTexture = GLTFModel.textures[Index];
+                // Parse material
+                Graphic::Mesh::Primitive Primitive;
+
+                if (GLTFPrimitive.Material >= 0 && GLTFPrimitive.Material < Materials.size())
+                {
+                    Primitive.Material = static_cast<SInt16>(GLTFPrimitive.Material);
+                }
+
+                // Parse vertices
+                Vector<Channel> Channels;
+                UInt32         Vertices = 0;
+
+                for (const auto & [Name, Accessor] : GLTFPrimitive.Attributes)
+                {
+                    const Graphic::VertexSemantic Semantic = As(Name);
+
+                    if (Semantic == Graphic::VertexSemantic::None)
+                    {
+                        continue;
+                    }
+
+                    if (Accessor < 0 || Accessor >= Accessors.size())
+                    {
+                        Log::Warn("GLTFLoader: Attribute '{}' of {} references a missing accessor",
+                            Name, GLTFMesh.Name);
+                        return false;
+                    }
+
+                    ConstRef<GLTFDocument::Accessor> GLTFAccessor = Accessors[Accessor];
+
+                    if (Channel Input { Semantic }; ReadChannel(Document, GLTFAccessor, Input))
+                    {
+                        if (! Channels.empty() && GLTFAccessor.Count != Vertices)
+                        {
+                            Log::Warn("GLTFLoader: Attribute '{}' of {} has a mismatched count", Name, GLTFMesh.Name);
+                            return false;
+                        }
+                        Vertices = GLTFAccessor.Count;
+                        Channels.emplace_back(Move(Input));
+                    }
+                    else
+                    {
+                        Log::Warn("GLTFLoader: Attribute '{}' of {} is out of bounds", Name, GLTFMesh.Name);
+                        return false;
+                    }
+                }
+
+                // Parse indices
+                Vector<UInt32> Indices;
+
+                if (GLTFPrimitive.Indices >= 0)
+                {
+                    if (GLTFPrimitive.Indices >= Accessors.size()
+                        || ! ReadIndices(Document, Accessors[GLTFPrimitive.Indices], Indices))
+                    {
+                        Log::Warn("GLTFLoader: Indices of {} are malformed", GLTFMesh.Name);
+                        return false;
+                    }
+                    if (std::ranges::any_of(Indices, [Vertices](UInt32 Index) { return Index >= Vertices; }))
+                    {
+                        Log::Warn("GLTFLoader: Indices of {} reference missing vertices", GLTFMesh.Name);
+                        return false;
+                    }
+                }
+
+                if (Settings.Quantize)
+                {
+                    for (Ref<Channel> Input : Channels)
+                    {
+                        Quantize(Input, Vertices);
+                    }
+                }
+
+                // Triangle lists are re-ordered for the post-transform cache, non-indexed ones get an index list
+                // so that their shared vertices can be merged.
+                const Bool IsTriangleList = (GLTFPrimitive.Mode == GLTFDocument::k_ModeTriangles);
+
+                if (Settings.Optimize && IsTriangleList && Vertices > 0)
+                {
+                    if (Indices.empty())
+                    {
+                        Indices.resize(Vertices);
+
+                        for (UInt32 Vertex = 0; Vertex < Vertices; ++Vertex)
+                        {
+                            Indices[Vertex] = Vertex;
+                        }
+                    }
+
+                    const UInt32 Original = Vertices;
+                    const Real32 Before   = Graphic::GetACMR(Indices, Vertices);
 
-                Material->SetTexture(Graphic::TextureSlot::Roughness, LoadTexture(GLTFModel, GLTFTexture));
-                Material->SetSampler(Graphic::TextureSlot::Roughness, LoadSampler(GLTFModel.samplers[GLTFTexture.sampler]));
+                    Vertices = Optimize(Channels, Indices, Vertices, Settings.Overdraw);
+
+                    Log::Info("GLTFLoader: Optimized '{}', {} to {} vertices and ACMR {:.3f} to {:.3f}",
+                        GLTFMesh.Name, Original, Vertices, Before, Graphic::GetACMR(Indices, Vertices));
+                }
+
+                // Every channel is a multiple of 4 bytes, so the offsets stay aligned for the device.
+                for (ConstRef<Channel> Input : Channels)
+                {
+                    const UInt32 Offset = BlockForVerticesSize;
+                    BlockForVerticesSize += Input.Bytes.size();
+
+                    Primitive.Attributes[CastEnum(Input.Semantic)] = {
+                        static_cast<UInt32>(Input.Bytes.size()), Offset, Input.Stride, Input.Format
+                    };
+                }
+
+                // Indices are stored with the narrowest type every device can fetch.
+                const auto WriteIndices = [&](ConstRef<Vector<UInt32>> Source)
+                {
+                    const UInt32 Stride = (Vertices <= UINT16_MAX + 1 ? sizeof(UInt16) : sizeof(UInt32));
+                    const UInt32 Offset = Align(BlockForIndices.size(), Stride);
+
+                    BlockForIndices.resize(Offset + Source.size() * Stride);
+
+                    for (UInt32 Element = 0; Element < Source.size(); ++Element)
+                    {
+                        if (Stride == sizeof(UInt16))
+                        {
+                            const UInt16 Index = Source[Element];
+                            std::memcpy(BlockForIndices.data() + Offset + Element * Stride, & Index, Stride);
+                        }
+                        else
+                        {
+                            std::memcpy(BlockForIndices.data() + Offset + Element * Stride, & Source[Element], Stride);
+                        }
+                    }
+                    return Graphic::Mesh::Attribute { static_cast<UInt32>(Source.size() * Stride), Offset, Stride };
+                };
+
+                if (! Indices.empty())
+                {
+                    Primitive.Indices = WriteIndices(Indices);
+                }
+
+                // Bound every vertex of the primitive so it can be culled on its own.
+                const Bool HasBounds = GetBounds(Channels, Vertices, Primitive.Minimum, Primitive.Maximum);
+
+                // Coarser levels index the same vertices, so they only add to the index block. The deviation is
+                // relative to the size of the primitive, so the same setting fits models of any scale.
+                if (Settings.Levels > 0 && IsTriangleList && HasBounds && ! Indices.empty())
+                {
+                    const Real32 Extent = (Primitive.Maximum - Primitive.Minimum).GetLength();
+
+                    const Vector<Detail> Details = Simplify(
+                        Channels, Indices, Vertices, Extent, Settings.Levels, Settings.Reduction, Settings.Deviation);
+
+                    for (UInt32 Level = 0; Level < Details.size(); ++Level)
+                    {
+                        Primitive.Levels[Level] = { WriteIndices(Details[Level].Indices), Details[Level].Error };
+
+                        Log::Info("GLTFLoader: Simplified '{}' to {} triangles at level {} with an error of {:.4f}",
+                            GLTFMesh.Name, Details[Level].Indices.size() / 3, Level + 1, Details[Level].Error);
+                    }
+                }
+
+                // Continue with the next primitive, the storage of each stream moves along so the views stay valid.
+                std::ranges::move(Channels, std::back_inserter(Streams));
+                Primitives.emplace_back(Move(Primitive));
             }
-            if (SInt32 Index = GLTFMaterial.normalTexture.index; Index >= 0)
+        }
+
+        // Write the vertex block stream by stream, in the same layout as a single block.
+        Archive.WriteInt<UInt32>(BlockForVerticesSize);
+
+        for (ConstRef<Channel> Input : Streams)
+        {
+            if (! Input.Bytes.empty())
             {
-                ConstRef<tinygltf::Texture> GLTFTexture = GLTFModel.textures[Index];
+                Archive.Write<ConstPtr<UInt8>>(Input.Bytes.data(), Input.Bytes.size());
+            }
+        }
+        Archive.WriteBlock(CPtr<const UInt8>(BlockForIndices));
+
+        // Decode every embedded image in parallel, straight from the binary chunk into its own buffer.
+        ConstRef<Vector<GLTFDocument::Image>> GLTFImages = Document.GetImages();
+
+        Vector<STBLoader::Image> Images(GLTFImages.size());
+        Vector<Vector<UInt8>>    Texels(GLTFImages.size());
+
+        for (UInt32 Index = 0; Index < GLTFImages.size(); ++Index)
+        {
+            Images[Index].File = Document.GetView(GLTFImages[Index].View);
+        }
+
+        STBLoader::Decode(Service, Images, [&](UInt32 Index, UInt16 Width, UInt16 Height) -> Ptr<UInt8>
+        {
+            // The texels are written as a block, whose size must fit in 32 bits.
+            const UInt64 Size = static_cast<UInt64>(Width) * Height * 4;
 
-                Material->SetTexture(Graphic::TextureSlot::Normal, LoadTexture(GLTFModel, GLTFTexture));
-                Material->SetSampler(Graphic::TextureSlot::Normal, LoadSampler(GLTFModel.samplers[GLTFTexture.sampler]));
+            if (Size > UINT32_MAX)
+            {
+                Log::Warn("GLTFLoader: Image {} ({}x{}) is too large to be stored", Index, Width, Height);
+                return nullptr;
             }
-            if (SInt32 Index = GLTFMaterial.emissiveTexture.index; Index >= 0)
+
+            Texels[Index].resize(Size);
+            return Texels[Index].data();
+        });
+
+        // Write the texels of each texture
+        ConstRef<Vector<GLTFDocument::Texture>> Textures = Document.GetTextures();
+        ConstRef<Vector<GLTFDocument::Sampler>> Samplers = Document.GetSamplers();
+
+        Archive.WriteInt<UInt32>(Textures.size());
+
+        for (ConstRef<GLTFDocument::Texture> GLTFTexture : Textures)
+        {
+            const Graphic::Sampler Sampler = GLTFTexture.Sampler >= 0 && GLTFTexture.Sampler < Samplers.size()
+                ? LoadSampler(Samplers[GLTFTexture.Sampler])
+                : LoadSampler(GLTFDocument::Sampler());
+
+            Archive.WriteString8(GLTFTexture.Name);
+            Archive.WriteObject(Sampler);
+
+            if (GLTFTexture.Source >= 0 && GLTFTexture.Source < Images.size() && Images[GLTFTexture.Source].Decoded)
             {
-                ConstRef<tinygltf::Texture> GLTFTexture = GLTFModel.textures[Index];
+                ConstRef<STBLoader::Image> Image = Images[GLTFTexture.Source];
 
-                Material->SetTexture(Graphic::TextureSlot::Emissive, LoadTexture(GLTFModel, GLTFTexture));
-                Material->SetSampler(Graphic::TextureSlot::Emissive, LoadSampler(GLTFModel.samplers[GLTFTexture.sampler]));
+                Archive.WriteUInt16(Image.Width);
+                Archive.WriteUInt16(Image.Height);
+                Archive.WriteBlock(CPtr<const UInt8>(Texels[GLTFTexture.Source]));
             }
-            if (SInt32 Index = GLTFMaterial.occlusionTexture.index; Index >= 0)
+            else
             {
-                ConstRef<tinygltf::Texture> GLTFTexture = GLTFModel.textures[Index];
+                Log::Warn("GLTFLoader: Texture '{}' has no decodable image", GLTFTexture.Name);
 
-                Material->SetTexture(Graphic::TextureSlot::Occlusion, LoadTexture(GLTFModel, GLTFTexture));
-                Material->SetSampler(Graphic::TextureSlot::Occlusion, LoadSampler(GLTFModel.samplers[GLTFTexture.sampler]));
+                Archive.WriteUInt16(0);
+                Archive.WriteUInt16(0);
+                Archive.WriteBlock(CPtr<const UInt8>());
             }
+        }
 
-            // @TODO: Create uniform buffer for the PBR / Custom properties
+        // Write the texture bound to each slot of every material
+        Archive.WriteInt<UInt32>(Materials.size());
 
-            Materials[ID++] = Material;
+        for (ConstRef<GLTFDocument::Material> GLTFMaterial : Materials)
+        {
+            const Array<std::pair<Graphic::TextureSlot, SInt32>, 5> Bindings
+            {{
+                { Graphic::TextureSlot::Diffuse,   GLTFMaterial.Diffuse   },
+                { Graphic::TextureSlot::Roughness, GLTFMaterial.Roughness },
+                { Graphic::TextureSlot::Normal,    GLTFMaterial.Normal    },
+                { Graphic::TextureSlot::Emissive,  GLTFMaterial.Emissive  },
+                { Graphic::TextureSlot::Occlusion, GLTFMaterial.Occlusion },
+            }};
+
+            Archive.WriteString8(GLTFMaterial.Name);
+            Archive.WriteInt<UInt32>(Bindings.size());
+
+            for (const auto [Slot, Index] : Bindings)
+            {
+                Archive.WriteEnum(Slot);
+                Archive.WriteInt32(Index);
+            }
+
+            // @TODO: Create uniform buffer for the PBR / Custom properties
         }
 
-        // Parse each mesh from the model
-        const SPtr<Graphic::Mesh> Mesh = NewPtr<Graphic::Mesh>(Uri { Asset.GetKey() });
-        Mesh->Load(Move(BlockForVertices), Move(BlockForIndices));
+        Archive.WriteVector<Graphic::Mesh::Primitive>(Primitives);
+        return true;
+    }
 
-        for (ConstRef<tinygltf::Mesh> GLTFMesh : GLTFModel.meshes)
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool GLTFLoader::Build(Ref<Reader> Archive, Ref<Graphic::Model> Asset)
+    {
+        constexpr UInt8 k_DefaultMipmaps = 1;
+        constexpr UInt8 k_DefaultSamples = 1;
+
+        // Copy the vertex and the index block
+        const auto ReadData = [&]()
         {
-            if (GLTFMesh.primitives.size() > 1)
+            const CPtr<const UInt8> Block = Archive.ReadBlock<const UInt8>();
+
+            Data Chunk(Block.size());
+            Chunk.Copy(Block.data(), Block.size());
+            return Chunk;
+        };
+        Data BlockForVertices = ReadData();
+        Data BlockForIndices  = ReadData();
+
+        // Create each texture from its texels
+        Vector<SPtr<Graphic::Texture>> Textures(Archive.ReadInt<UInt32>());
+        Vector<Graphic::Sampler>       Samplers(Textures.size());
+
+        for (UInt32 Index = 0; Index < Textures.size(); ++Index)
+        {
+            const CStr   Name   = Archive.ReadString8();
+            Samplers[Index]     = Archive.ReadObject<Graphic::Sampler>();
+            const UInt16 Width  = Archive.ReadUInt16();
+            const UInt16 Height = Archive.ReadUInt16();
+            Data         Texels = ReadData();
+
+            if (Texels.HasData())
             {
-                Log::Warn("GLTFLoader: Multiple primitives unsupported, skipping {}", GLTFMesh.name);
-                continue;
+                Textures[Index] = NewPtr<Graphic::Texture>(Uri { Name });
+                Textures[Index]->Load(
+                    Graphic::TextureFormat::RGBA8UIntNorm,
+                    Graphic::TextureLayout::Source, Width, Height, k_DefaultMipmaps, k_DefaultSamples, Move(Texels));
             }
+        }
 
-            ConstRef<tinygltf::Primitive> GLTFPrimitive = GLTFMesh.primitives[0];
+        // Create each material from its bindings
+        Vector<SPtr<Graphic::Material>> Materials(Archive.ReadInt<UInt32>());
 
-            // Parse material
-            Graphic::Mesh::Primitive Primitive;
-            Primitive.Material = static_cast<SInt8>(GLTFPrimitive.material);
+        for (UInt32 ID = 0; ID < Materials.size(); ++ID)
+        {
+            const SPtr<Graphic::Material> Material = NewPtr<Graphic::Material>(Uri { Archive.ReadString8() });
+            Material->SetExclusive(true);
 
-            // Parse vertices
-            for (const auto & [Name, Accessor] : GLTFPrimitive.attributes)
+            for (UInt32 Binding = 0, Limit = Archive.ReadInt<UInt32>(); Binding < Limit; ++Binding)
             {
-                ConstRef<tinygltf::Accessor>   GLTFAccessor = GLTFModel.accessors[Accessor];
-                ConstRef<tinygltf::BufferView> GLTFView     = GLTFModel.bufferViews[GLTFAccessor.bufferView];
-
-                const UInt32 Length = tinygltf::GetComponentSizeInBytes(GLTFAccessor.componentType)
-                                    * tinygltf::GetNumComponentsInType(GLTFAccessor.type)
-                                    * GLTFAccessor.count;
-                const UInt32 Offset = GLTFView.byteOffset + GLTFAccessor.byteOffset;
-                const UInt32 Stride = GLTFAccessor.ByteStride(GLTFView);
+                const auto   Slot  = Archive.ReadEnum<Graphic::TextureSlot>();
+                const SInt32 Index = Archive.ReadInt32();
 
-                if (const Graphic::VertexSemantic Semantic = As(Name); Semantic != Graphic::VertexSemantic::None)
+                if (Index >= 0 && Index < Textures.size() && Textures[Index])
                 {
-                    Primitive.Attributes[CastEnum(Semantic)] = { Length, Offset, Stride };
+                    Material->SetTexture(Slot, Textures[Index]);
+                    Material->SetSampler(Slot, Samplers[Index]);
                 }
             }
 
-            // Parse indices
-            if (GLTFPrimitive.indices >= 0)
-            {
-                ConstRef<tinygltf::Accessor>   GLTFAccessor = GLTFModel.accessors[GLTFPrimitive.indices];
-                ConstRef<tinygltf::BufferView> GLTFView     = GLTFModel.bufferViews[GLTFAccessor.bufferView];
+            Materials[ID] = Material;
+        }
 
-                const UInt32 Length = tinygltf::GetComponentSizeInBytes(GLTFAccessor.componentType)
-                                    * tinygltf::GetNumComponentsInType(GLTFAccessor.type)
-                                    * GLTFAccessor.count;
-                const UInt32 Offset = GLTFView.byteOffset + GLTFAccessor.byteOffset;
-                const UInt32 Stride = GLTFAccessor.ByteStride(GLTFView);
+        // Create the mesh with its primitives
+        Vector<Graphic::Mesh::Primitive> Primitives;
+        Archive.ReadVector<Graphic::Mesh::Primitive>(Primitives);
 
-                Primitive.Indices = { Length, Offset, Stride };
-            }
+        const SPtr<Graphic::Mesh> Mesh = NewPtr<Graphic::Mesh>(Uri { Asset.GetKey() });
+        Mesh->Load(Move(BlockForVertices), Move(BlockForIndices));
 
-            // Continue with the next primitive
+        for (Ref<Graphic::Mesh::Primitive> Primitive : Primitives)
+        {
             Mesh->AddPrimitive(Move(Primitive));
         }
 
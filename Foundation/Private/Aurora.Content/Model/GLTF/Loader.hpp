@@ -35,5 +35,34 @@ namespace Content
 
         // \see AbstractLoader::Load
         Bool OnLoad(Ref<class Service> Service, Any<Data> File, Ref<Graphic::Model> Asset);
+
+    private:
+
+        // Version of the cached model layout, must be bumped whenever the decoded form changes.
+        static constexpr UInt64 k_CacheVersion = 5;
+
+        // Extension appended to the model's filename to find its sidecar, a TOML file with a 'Model' section.
+        static constexpr CStr   k_Sidecar      = ".meta";
+
+        // -=(Undocumented)=-
+        struct Options
+        {
+            Bool   Optimize  = true;
+            Bool   Quantize  = false;
+            Real32 Overdraw  = 1.05f;
+            UInt8  Levels    = 3;
+            Real32 Reduction = 0.5f;
+            Real32 Deviation = 0.02f;
+        };
+
+        // -=(Undocumented)=-
+        Options ReadOptions(Ref<class Service> Service, Ref<Resource> Asset) const;
+
+        // Parses the model and writes it in its decoded form: the packed vertex and index blocks, the
+        // texels of every embedded texture, the material bindings and the primitives.
+        Bool Decode(Ref<class Service> Service, ConstRef<Data> File, ConstRef<Options> Settings, Ref<Writer> Archive);
+
+        // Creates the model from its decoded form.
+        Bool Build(Ref<Reader> Archive, Ref<Graphic::Model> Asset);
     };
 }
\ No newline at end of file
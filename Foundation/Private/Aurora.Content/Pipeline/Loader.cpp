@@ -12,6 +12,7 @@
 
 #include "Loader.hpp"
 #include "Aurora.Content/Service.hpp"
+#include "Aurora.Graphic/PipelineCache.hpp"
 #include "Aurora.Graphic/Shader.hpp"
 
 #ifdef    SDL_PLATFORM_WINDOWS
@@ -61,9 +62,10 @@ namespace Content
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-    PipelineLoader::PipelineLoader(Graphic::Backend Backend, Graphic::Language Target)
-        : mBackend { Backend },
-          mTarget  { Target }
+    PipelineLoader::PipelineLoader(Graphic::Backend Backend, Graphic::Language Target, CStr Identity)
+        : mBackend  { Backend },
+          mTarget   { Target },
+          mIdentity { Identity }
     {
     }
 
@@ -72,9 +74,59 @@ namespace Content
 
     Bool PipelineLoader::OnLoad(Ref<Service> Service, Any<Data> File, Ref<Graphic::Pipeline> Asset)
     {
-        Graphic::Descriptor Description;
+        Effect Effect;
 
-        TOMLParser        Parser(File.GetText());
+        // Skip parsing the effect entirely when an entry for the same source is in the cache.
+        const UInt64 Hash = XXHash64(File.GetSpan<UInt8>(), k_CacheVersion);
+
+        if (Data Cache = Service.FindCache("effect", Hash); Cache.HasData())
+        {
+            Reader Archive(Cache.GetSpan<UInt8>());
+            Effect = Archive.ReadObject<PipelineLoader::Effect>();
+        }
+        else
+        {
+            Parse(File.GetText(), Effect);
+
+            Writer Archive;
+            Archive.WriteObject(Effect);
+            Service.SaveCache("effect", Hash, Archive.GetData());
+        }
+
+        // Compile each stage of the program
+        Array<Data, Graphic::k_MaxStages> Stages;
+        Stages[0] = Compile(Service, Asset, Effect.Programs[0], Graphic::Stage::Vertex);
+        Stages[1] = Compile(Service, Asset, Effect.Programs[1], Graphic::Stage::Fragment);
+        Stages[2] = Compile(Service, Asset, Effect.Programs[2], Graphic::Stage::Geometry);
+
+        if (Stages[0].HasData() && Stages[1].HasData())
+        {
+            // Read the program the driver linked from the same stages on a previous run, here rather than on the
+            // rendering thread so that creating the pipeline never waits on the storage.
+            Data Binary;
+
+            if (!mIdentity.empty())
+            {
+                const UInt64 Key = Graphic::GetPipelineKey(
+                    Stages[0].GetSpan<UInt8>(), Stages[1].GetSpan<UInt8>(), Stages[2].GetSpan<UInt8>(), mIdentity);
+                Binary = Service.FindCache("pipeline", Key);
+            }
+
+            Asset.Load(Move(Stages), Move(Effect.Slots), Move(Effect.Description), Move(Binary));
+            return true;
+        }
+
+        return false;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void PipelineLoader::Parse(CStr Text, Ref<Effect> Effect)
+    {
+        Ref<Graphic::Descriptor> Description = Effect.Description;
+
+        TOMLParser        Parser(Text);
         const TOMLSection Properties = Parser.GetSection("Properties");
         const TOMLSection Program    = Parser.GetSection("Program");
 
@@ -129,57 +181,114 @@ namespace Content
         // Parse 'textures' section
         const TOMLSection Textures = Program.GetSection("Textures");
 
-        Array<Graphic::TextureSlot, Graphic::k_MaxSlots> Slots { };
         for (const Graphic::TextureSlot Slot : ListEnum<Graphic::TextureSlot>())
         {
             if (const SInt32 ID = Textures.GetNumber(NameEnum(Slot), -1); ID != -1)
             {
-                Slots[ID] = Slot;
+                Effect.Slots[ID] = Slot;
             }
         }
 
         // Parse 'shader' section
-        Array<Data, Graphic::k_MaxStages> Stages;
-        Stages[0] = Compile(Service, Program.GetSection("Vertex"), Graphic::Stage::Vertex);
-        Stages[1] = Compile(Service, Program.GetSection("Fragment"), Graphic::Stage::Fragment);
-        Stages[2] = Compile(Service, Program.GetSection("Geometry"), Graphic::Stage::Geometry);
+        Effect.Programs[0] = Parse(Program.GetSection("Vertex"));
+        Effect.Programs[1] = Parse(Program.GetSection("Fragment"));
+        Effect.Programs[2] = Parse(Program.GetSection("Geometry"));
+    }
 
-        if (Stages[0].HasData() && Stages[1].HasData())
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    PipelineLoader::Program PipelineLoader::Parse(ConstRef<TOMLSection> Section)
+    {
+        Program Result;
+
+        if (!Section.IsEmpty())
         {
-            Asset.Load(Move(Stages), Move(Slots), Move(Description));
-            return true;
-        }
+            Result.Filename = Section.GetString("Filename");
+            Result.GLSL     = Section.GetString("GLSL");
+            Result.Entry    = Section.GetString("Entry", "main");
 
-        return false;
+            for (const CStr Definition : Section.GetStringArray("Defines"))
+            {
+                Result.Defines.emplace_back(Definition);
+            }
+        }
+        return Result;
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-    Data PipelineLoader::Compile(Ref<Service> Service, ConstRef<TOMLSection> Section, Graphic::Stage Stage)
+    Data PipelineLoader::Compile(Ref<Service> Service, Ref<Graphic::Pipeline> Asset, ConstRef<Program> Program, Graphic::Stage Stage)
     {
-        if (!Section.IsEmpty())
+        if (mBackend == Graphic::Backend::GLES3)
         {
-            ConstSPtr<Graphic::Shader> Shader = Service.Load<Graphic::Shader>(Section.GetString("Filename"));
-            const CStr         Code     = Shader->GetBytecode();
-            const CStr         Entry    = Section.GetString("Entry", "main");
-            const Vector<CStr> Defines  = Section.GetStringArray("Defines");
+            if (Program.GLSL.empty())
+            {
+                if (!Program.Filename.empty())
+                {
+                    Log::Warn("PipelineLoader: '{}' has no GLSL source for the {} stage", Asset.GetKey().GetUrl(), NameEnum(Stage));
+                }
+                return Data();
+            }
 
-            Vector<Property> Properties(Defines.size());
+            // Assembling the source is cheaper than looking it up, the driver caches the linked program instead.
+            ConstSPtr<Graphic::Shader> Shader = Service.Require<Graphic::Shader>(Asset, Program.GLSL, false);
 
-            for (CStr Definition : Defines)
+            if (!Shader)
             {
-                const UInt Delimiter = Definition.find_first_of('=');
+                return Data();
+            }
+            return CompileGLSL(Program.Entry, Shader->GetBytecode(), GetProperties(Program), Stage);
+        }
 
-                const SStr Name(Delimiter != CStr::npos ? Definition.substr(0, Delimiter) : Definition);
-                const SStr Data(Delimiter != CStr::npos ? Definition.substr(Delimiter) : "true");
+        if (!Program.Filename.empty())
+        {
+            // The source is needed right away, hence the shader is loaded synchronously.
+            ConstSPtr<Graphic::Shader> Shader = Service.Require<Graphic::Shader>(Asset, Program.Filename, false);
 
-                Properties.emplace_back(Property { Name, Data });
+            if (!Shader)
+            {
+                return Data();
+            }
+
+            const CStr Code = Shader->GetBytecode();
+
+            // Skip compiling entirely when the same stage has been compiled before from the same files, with the
+            // same entry point, defines and target.
+            const auto Combine = [](CStr Text, UInt64 Seed)
+            {
+                return XXHash64(CPtr<const UInt8>(reinterpret_cast<ConstPtr<UInt8>>(Text.data()), Text.size()), Seed);
+            };
+
+            const UInt8 Profile[] = { static_cast<UInt8>(mTarget), static_cast<UInt8>(Stage) };
+            UInt64      Hash      = XXHash64(Profile, Shader->GetHash() ^ k_CacheVersion);
+
+            Hash = Combine(Program.Entry, Hash);
+
+            for (CStr Definition : Program.Defines)
+            {
+                Hash = Combine(Definition, Hash);
+            }
+
+            if (Data Cache = Service.FindCache("stage", Hash); Cache.HasData())
+            {
+                return Cache;
             }
 
+            Vector<Property> Properties = GetProperties(Program);
+
+            Data Compilation;
+
 #ifdef    SDL_PLATFORM_WINDOWS
-            return CompileDXBC(Entry, Code, Properties, Stage);
+            Compilation = CompileDXBC(Program.Entry, Code, Properties, Stage);
 #endif // SDL_PLATFORM_WINDOWS
+
+            if (Compilation.HasData())
+            {
+                Service.SaveCache("stage", Hash, Compilation.GetSpan<UInt8>());
+            }
+            return Compilation;
         }
         return Data();
     }
@@ -187,6 +296,26 @@ namespace Content
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+    Vector<PipelineLoader::Property> PipelineLoader::GetProperties(ConstRef<Program> Program)
+    {
+        Vector<Property> Properties;
+        Properties.reserve(Program.Defines.size());
+
+        for (CStr Definition : Program.Defines)
+        {
+            const UInt Delimiter = Definition.find_first_of('=');
+
+            const SStr Name(Delimiter != CStr::npos ? Definition.substr(0, Delimiter) : Definition);
+            const SStr Data(Delimiter != CStr::npos ? Definition.substr(Delimiter + 1) : "true");
+
+            Properties.emplace_back(Property { Name, Data });
+        }
+        return Properties;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
     Data PipelineLoader::CompileDXBC(CStr Entry, CStr Code, Ref<Vector<Property>> Properties, Graphic::Stage Stage)
     {
         Data Compilation;
@@ -249,4 +378,46 @@ namespace Content
 
         return Compilation;
     }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Data PipelineLoader::CompileGLSL(CStr Entry, CStr Code, ConstRef<Vector<Property>> Properties, Graphic::Stage Stage)
+    {
+        if (Stage == Graphic::Stage::Geometry)
+        {
+            Log::Error("Failed to compile shader: GLSL ES 3.0 has no geometry stage");
+            return Data();
+        }
+
+        static constexpr CStr k_Stages[] = { "STAGE_VERTEX", "STAGE_FRAGMENT", "STAGE_GEOMETRY" };
+
+        SStr Source;
+        Source.reserve(Code.size() + 512);
+
+        // The version directive must come first, followed by the precision fragment shaders have no default for.
+        Source.append("#version 300 es\n");
+        Source.append("precision highp float;\n");
+        Source.append("precision highp int;\n");
+        Source.append(Format("#define {} 1\n", k_Stages[CastEnum(Stage)]));
+
+        for (ConstRef<Property> Property : Properties)
+        {
+            Source.append(Format("#define {} {}\n", Property.Name, Property.Definition));
+        }
+
+        // GLSL requires the entry point to be named 'main', any other one is renamed to it.
+        if (Entry != "main")
+        {
+            Source.append(Format("#define {} main\n", Entry));
+        }
+
+        // Keep the line numbers reported by the driver relative to the source file.
+        Source.append("#line 1\n");
+        Source.append(Code);
+
+        Data Compilation(Source.size());
+        Compilation.Copy(Source.data(), Source.size());
+        return Compilation;
+    }
 }
\ No newline at end of file
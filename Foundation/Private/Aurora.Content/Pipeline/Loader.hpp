@@ -26,8 +26,8 @@ namespace Content
     {
     public:
 
-        // -=(Undocumented)=-
-        PipelineLoader(Graphic::Backend Backend, Graphic::Language Target);
+        // Creates the loader for the given device, whose identity selects the pipeline entries read from the cache.
+        PipelineLoader(Graphic::Backend Backend, Graphic::Language Target, CStr Identity);
 
         // \see Loader::GetExtensions
         List<CStr> GetExtensions() const override
@@ -41,6 +41,9 @@ namespace Content
 
     private:
 
+        // Version of the cached effects and stages, must be bumped whenever 'Effect' or the compiler settings change.
+        static constexpr UInt64 k_CacheVersion = 2;
+
         // -=(Undocumented)=-
         struct Property
         {
@@ -51,14 +54,76 @@ namespace Content
             SStr Definition;
         };
 
+        // -=(Undocumented)=-
+        struct Program
+        {
+            // -=(Undocumented)=-
+            SStr         Filename;
+
+            // Source of the stage written in GLSL ES 3.0, used instead of 'Filename' by the GLES3 backend.
+            SStr         GLSL;
+
+            // -=(Undocumented)=-
+            SStr         Entry;
+
+            // -=(Undocumented)=-
+            Vector<SStr> Defines;
+
+            // -=(Undocumented)=-
+            template<typename Type>
+            void OnSerialize(Stream<Type> Archive)
+            {
+                Archive.SerializeString8(Filename);
+                Archive.SerializeString8(GLSL);
+                Archive.SerializeString8(Entry);
+                Archive.SerializeVector(Defines);
+            }
+        };
+
+        // -=(Undocumented)=-
+        struct Effect
+        {
+            // -=(Undocumented)=-
+            Graphic::Descriptor                              Description;
+
+            // -=(Undocumented)=-
+            Array<Graphic::TextureSlot, Graphic::k_MaxSlots> Slots { };
+
+            // -=(Undocumented)=-
+            Array<Program, Graphic::k_MaxStages>             Programs;
+
+            // -=(Undocumented)=-
+            template<typename Type>
+            void OnSerialize(Stream<Type> Archive)
+            {
+                Archive.SerializeObject(Description);
+                Archive.SerializeArray(Slots);
+                Archive.SerializeArray(Programs);
+            }
+        };
+
     private:
 
         // -=(Undocumented)=-
-        Data Compile(Ref<Service> Service, ConstRef<TOMLSection> Section, Graphic::Stage Stage);
+        void Parse(CStr Text, Ref<Effect> Effect);
+
+        // -=(Undocumented)=-
+        Program Parse(ConstRef<TOMLSection> Section);
+
+        // -=(Undocumented)=-
+        Data Compile(Ref<Service> Service, Ref<Graphic::Pipeline> Asset, ConstRef<Program> Program, Graphic::Stage Stage);
+
+        // -=(Undocumented)=-
+        static Vector<Property> GetProperties(ConstRef<Program> Program);
 
         // -=(Undocumented)=-
         Data CompileDXBC(CStr Entry, CStr Code, Ref<Vector<Property>> Properties, Graphic::Stage Stage);
 
+        // Assembles the source handed to the GLES3 driver, which compiles and links it (caching the linked program).
+        // The version and default precision directives are prepended along with every define, including one named
+        // after the stage ('STAGE_VERTEX' or 'STAGE_FRAGMENT') so that a single file can hold every stage.
+        Data CompileGLSL(CStr Entry, CStr Code, ConstRef<Vector<Property>> Properties, Graphic::Stage Stage);
+
     private:
 
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -66,5 +131,6 @@ namespace Content
 
         Graphic::Backend  mBackend;
         Graphic::Language mTarget;
+        SStr              mIdentity;
     };
 }
\ No newline at end of file
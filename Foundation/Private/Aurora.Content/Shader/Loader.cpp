@@ -11,6 +11,7 @@
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
 #include "Loader.hpp"
+#include "Aurora.Content/Service.hpp"
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 // [   CODE   ]
@@ -21,9 +22,326 @@ namespace Content
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+    static CStr Trim(CStr Text)
+    {
+        const UInt First = Text.find_first_not_of(" \t\r");
+        const UInt Last  = Text.find_last_not_of(" \t\r");
+        return First == CStr::npos ? CStr() : Text.substr(First, Last - First + 1);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Bool ReadDirective(CStr Line, CStr Name, Ref<CStr> Argument)
+    {
+        const CStr Text = Trim(Line);
+
+        if (Text.empty() || Text[0] != '#')
+        {
+            return false;
+        }
+
+        const CStr Directive = Trim(Text.substr(1));
+
+        if (! Directive.starts_with(Name)
+            || (Directive.size() > Name.size() && Directive[Name.size()] != ' ' && Directive[Name.size()] != '\t'
+                && Directive[Name.size()] != '"' && Directive[Name.size()] != '<'))
+        {
+            return false;
+        }
+        Argument = Trim(Directive.substr(Name.size()));
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Bool Scan(CStr Line, Bool Comment)
+    {
+        // Returns whether a block comment remains open at the end of the line.
+        for (UInt Index = 0; Index + 1 < Line.size(); ++Index)
+        {
+            const CStr Pair = Line.substr(Index, 2);
+
+            if (Comment)
+            {
+                if (Pair == "*/")
+                {
+                    Comment = false;
+                    ++Index;
+                }
+            }
+            else if (Pair == "//")
+            {
+                break;
+            }
+            else if (Pair == "/*")
+            {
+                Comment = true;
+                ++Index;
+            }
+        }
+        return Comment;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
     Bool ShaderLoader::OnLoad(Ref<class Service> Service, Any<Data> File, Ref<Graphic::Shader> Asset)
     {
-        Asset.SetBytecode(File.GetText()); // TODO: Include files :(--D)
+        Expansion State;
+        State.Numbered = (Asset.GetKey().GetExtension() == "glsl");
+
+        // Every included file is read through the service, which declares it as a dependency so that editing any of
+        // them reloads this shader and, in turn, every pipeline built from it.
+        if (! Expand(Service, Asset, Asset.GetKey(), File.GetText(), State))
+        {
+            return false;
+        }
+
+        Asset.SetBytecode(State.Output, State.Hash);
         return true;
     }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool ShaderLoader::Expand(Ref<class Service> Service, Ref<Graphic::Shader> Asset, ConstRef<Uri> Key, CStr Text, Ref<Expansion> State)
+    {
+        if (State.Stack.size() >= k_MaxDepth)
+        {
+            Log::Warn("ShaderLoader: Includes of '{}' are nested too deeply", Key.GetUrl());
+            return false;
+        }
+
+        if (IsGuarded(Text))
+        {
+            if (State.Guarded.contains(SStr(Key.GetUrl())))
+            {
+                return true;
+            }
+            State.Guarded.emplace(Key.GetUrl());
+        }
+
+        const CPtr<const UInt8> Bytes(reinterpret_cast<ConstPtr<UInt8>>(Text.data()), Text.size());
+
+        State.Hash = XXHash64(Bytes, State.Hash);
+        State.Stack.emplace_back(Key.GetUrl());
+
+        if (std::ranges::find(State.Files, Key.GetUrl()) == State.Files.end())
+        {
+            State.Files.emplace_back(Key.GetUrl());
+        }
+
+        if (State.Stack.size() > 1)
+        {
+            Mark(State, Key, 1);
+        }
+
+        Bool   Comment  = false;
+        UInt32 Disabled = 0;
+        UInt32 Number   = 0;
+
+        for (UInt Offset = 0; Offset < Text.size();)
+        {
+            const UInt End  = Min(Text.find('\n', Offset), Text.size());
+            const CStr Line = Text.substr(Offset, End - Offset);
+            Offset = End + 1;
+            ++Number;
+
+            // Directives are only recognized on lines that do not begin within a block comment.
+            const Bool Commented = Comment;
+            Comment = Scan(Line, Comment);
+
+            CStr Argument;
+
+            if (Commented)
+            {
+                State.Output.append(Line);
+                State.Output.push_back('\n');
+                continue;
+            }
+
+            // Lines within an '#if 0' block are left to the compiler, which discards them.
+            if (Disabled > 0)
+            {
+                if (ReadDirective(Line, "if", Argument) || ReadDirective(Line, "ifdef", Argument)
+                    || ReadDirective(Line, "ifndef", Argument))
+                {
+                    ++Disabled;
+                }
+                else if (ReadDirective(Line, "endif", Argument))
+                {
+                    --Disabled;
+                }
+                else if (Disabled == 1 && (ReadDirective(Line, "else", Argument) || ReadDirective(Line, "elif", Argument)))
+                {
+                    Disabled = 0;
+                }
+
+                State.Output.append(Line);
+                State.Output.push_back('\n');
+                continue;
+            }
+
+            if (ReadDirective(Line, "if", Argument) && Argument == "0")
+            {
+                Disabled = 1;
+            }
+
+            // Keep the line, without the directive, so that the lines that follow keep their numbers.
+            if (ReadDirective(Line, "pragma", Argument) && Argument == "once")
+            {
+                State.Output.push_back('\n');
+                continue;
+            }
+
+            if (! ReadDirective(Line, "include", Argument))
+            {
+                State.Output.append(Line);
+                State.Output.push_back('\n');
+                continue;
+            }
+
+            if (Argument.size() < 2 || ! ((Argument.front() == '"' && Argument.back() == '"')
+                                       || (Argument.front() == '<' && Argument.back() == '>')))
+            {
+                Log::Warn("ShaderLoader: Malformed include '{}' in '{}'", Argument, Key.GetUrl());
+                return false;
+            }
+
+            const Uri Include = Resolve(Key, Argument.substr(1, Argument.size() - 2));
+
+            if (std::ranges::find(State.Stack, Include.GetUrl()) != State.Stack.end())
+            {
+                Log::Warn("ShaderLoader: '{}' includes itself through '{}'", Include.GetUrl(), Key.GetUrl());
+                return false;
+            }
+
+            const Data Source = Service.Read(Asset, Include);
+
+            if (! Source.HasData())
+            {
+                Log::Warn("ShaderLoader: '{}' included by '{}' not found", Include.GetUrl(), Key.GetUrl());
+                return false;
+            }
+
+            if (! Expand(Service, Asset, Include, Source.GetText(), State))
+            {
+                return false;
+            }
+
+            // Resume numbering the lines of this file right after the directive.
+            Mark(State, Key, Number + 1);
+        }
+
+        State.Stack.pop_back();
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void ShaderLoader::Mark(Ref<Expansion> State, ConstRef<Uri> Key, UInt32 Line)
+    {
+        if (State.Numbered)
+        {
+            const UInt Index = std::ranges::find(State.Files, Key.GetUrl()) - State.Files.begin();
+            State.Output.append(Format("#line {} {}\n", Line, Index));
+        }
+        else
+        {
+            State.Output.append(Format("#line {} \"{}\"\n", Line, Key.GetUrl()));
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Uri ShaderLoader::Resolve(ConstRef<Uri> Parent, CStr Path)
+    {
+        if (Path.find("://") != CStr::npos)
+        {
+            return Uri(Path);
+        }
+
+        // Walk up one folder for each leading '../'.
+        CStr Folder = Parent.GetFolder();
+
+        while (Path.starts_with("../"))
+        {
+            const UInt Separator = Folder.find_last_of('/');
+            Folder = (Separator == CStr::npos ? CStr() : Folder.substr(0, Separator));
+            Path   = Path.substr(3);
+        }
+
+        return Folder.empty()
+            ? Uri(Format("{}://{}", Parent.GetSchema(), Path))
+            : Uri(Format("{}://{}/{}", Parent.GetSchema(), Folder, Path));
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool ShaderLoader::IsGuarded(CStr Text)
+    {
+        CStr   Guard;
+        UInt32 Depth  = 0;
+        UInt32 Line   = 0;
+        Bool   Closed = false;
+
+        for (UInt Offset = 0; Offset < Text.size();)
+        {
+            const UInt End     = Min(Text.find('\n', Offset), Text.size());
+            const CStr Content = Trim(Text.substr(Offset, End - Offset));
+            Offset = End + 1;
+
+            if (Content.empty() || Content.starts_with("//"))
+            {
+                continue;
+            }
+
+            CStr Argument;
+
+            if (ReadDirective(Content, "pragma", Argument) && Argument == "once")
+            {
+                return true;
+            }
+
+            // Nothing but comments may follow the '#endif' that closes the guard.
+            if (Closed)
+            {
+                return false;
+            }
+
+            // The first two lines must be '#ifndef NAME' and '#define NAME'.
+            if (Line++ < 2)
+            {
+                if (Line == 1 && ReadDirective(Content, "ifndef", Argument) && ! Argument.empty())
+                {
+                    Guard = Argument;
+                }
+                else if (Line == 2 && ReadDirective(Content, "define", Argument) && Argument == Guard)
+                {
+                    Depth = 1;
+                }
+                else
+                {
+                    return false;
+                }
+                continue;
+            }
+
+            if (ReadDirective(Content, "if", Argument) || ReadDirective(Content, "ifdef", Argument)
+                || ReadDirective(Content, "ifndef", Argument))
+            {
+                ++Depth;
+            }
+            else if (ReadDirective(Content, "endif", Argument) && --Depth == 0)
+            {
+                Closed = true;
+            }
+        }
+        return Closed;
+    }
 }
\ No newline at end of file
@@ -21,7 +21,10 @@
 
 namespace Content
 {
-    // -=(Undocumented)=-
+    // Loads shader sources, expanding their '#include "File"' directives so that each one is compiled from a single
+    // self-contained source. Paths are relative to the including file unless they carry a schema, and files guarded
+    // by '#pragma once' or by an '#ifndef' guard are only expanded the first time. Includes within block comments or
+    // '#if 0' blocks are left untouched, and each expansion is wrapped in '#line' directives.
     class ShaderLoader final : public AbstractLoader<ShaderLoader, Graphic::Shader>
     {
     public:
@@ -29,11 +32,52 @@ namespace Content
         // \see Loader::GetExtensions
         List<CStr> GetExtensions() const override
         {
-            static constexpr List<CStr> EXTENSION_LIST = { "shader" };
+            static constexpr List<CStr> EXTENSION_LIST = { "shader", "glsl" };
             return EXTENSION_LIST;
         }
 
         // \see AbstractLoader::Load
         Bool OnLoad(Ref<class Service> Service, Any<Data> File, Ref<Graphic::Shader> Asset);
+
+    private:
+
+        // Deepest chain of nested includes, which guards against runaway recursion.
+        static constexpr UInt32 k_MaxDepth = 32;
+
+        // -=(Undocumented)=-
+        struct Expansion
+        {
+            // -=(Undocumented)=-
+            SStr         Output;
+
+            // Hash of every file expanded so far, in the order they were expanded.
+            UInt64       Hash = 0;
+
+            // Files being expanded, from the outermost one to the innermost one.
+            Vector<SStr> Stack;
+
+            // Files guarded against being expanded more than once, that have already been expanded.
+            Set<SStr>    Guarded;
+
+            // Every file expanded so far, in the order they were first expanded.
+            Vector<SStr> Files;
+
+            // Whether '#line' directives name files by their index, since GLSL only accepts a source string number.
+            Bool         Numbered = false;
+        };
+
+    private:
+
+        // -=(Undocumented)=-
+        Bool Expand(Ref<class Service> Service, Ref<Graphic::Shader> Asset, ConstRef<Uri> Key, CStr Text, Ref<Expansion> State);
+
+        // Emits a '#line' directive, so that the compiler reports the lines that follow as coming from the given file.
+        static void Mark(Ref<Expansion> State, ConstRef<Uri> Key, UInt32 Line);
+
+        // Returns the uri of an included file, resolved against the file that includes it.
+        static Uri Resolve(ConstRef<Uri> Parent, CStr Path);
+
+        // Returns true if the whole file is wrapped in an '#ifndef' guard or is marked with '#pragma once'.
+        static Bool IsGuarded(CStr Text);
     };
 }
\ No newline at end of file
@@ -0,0 +1,149 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2025 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Loader.hpp"
+#include "Aurora.Content/Service.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Content
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    KTXLoader::KTXLoader(Bool SupportsBC, Bool SupportsETC2)
+        : mSupportsBC   { SupportsBC },
+          mSupportsETC2 { SupportsETC2 }
+    {
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool KTXLoader::OnLoad(Ref<class Service> Service, Any<Data> File, Ref<Graphic::Texture> Asset)
+    {
+        constexpr UInt8 k_DefaultSamples = 1;
+
+        Reader Archive(File.GetSpan<UInt8>());
+
+        const Header Description = Archive.Read<Header>();
+
+        if (std::memcmp(Description.Identifier, k_Identifier, sizeof(k_Identifier)) != 0)
+        {
+            Log::Warn("Resources: '{}' is not a KTX2 container", Asset.GetKey().GetUrl());
+            return false;
+        }
+
+        if (Description.Depth > 1 || Description.Layers > 1 || Description.Faces != 1 || Description.Supercompression != 0)
+        {
+            Log::Warn("Resources: '{}' is not a plain 2D texture", Asset.GetKey().GetUrl());
+            return false;
+        }
+
+        Graphic::TextureFormat Format;
+
+        if (! GetFormat(Description.Format, Format) || ! IsSupported(Format))
+        {
+            Log::Warn("Resources: '{}' has a format ({}) the device cannot sample", Asset.GetKey().GetUrl(), Description.Format);
+            return false;
+        }
+
+        const UInt16 Width  = Description.Width;
+        const UInt16 Height = Description.Height;
+        const UInt8  Levels = Clamp<UInt32>(Description.Levels, 1, Graphic::k_MaxMipmap);
+
+        if (Width == 0 || Height == 0 || Width != Description.Width || Height != Description.Height)
+        {
+            Log::Warn("Resources: '{}' has an invalid size", Asset.GetKey().GetUrl());
+            return false;
+        }
+
+        // The container stores the smallest level first, pack them beginning with the largest one.
+        Data       Chunk(Graphic::GetTextureSize(Format, Width, Height, Levels));
+        Ptr<UInt8> Output = Chunk.GetData<UInt8>();
+
+        for (UInt8 Index = 0; Index < Levels; ++Index)
+        {
+            const Level  Entry = Archive.Read<Level>();
+            const UInt32 Size  = Graphic::GetTextureSize(
+                Format, Max<UInt16>(1, Width >> Index), Max<UInt16>(1, Height >> Index));
+
+            if (Entry.Length != Size || Entry.Offset > File.GetSize() || Entry.Length > File.GetSize() - Entry.Offset)
+            {
+                Log::Warn("Resources: '{}' has a truncated or malformed level {}", Asset.GetKey().GetUrl(), Index);
+                return false;
+            }
+
+            std::memcpy(Output, File.GetData<UInt8>() + Entry.Offset, Size);
+            Output += Size;
+        }
+
+        Asset.Load(Format, Graphic::TextureLayout::Source, Width, Height, Levels, k_DefaultSamples, Move(Chunk));
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool KTXLoader::GetFormat(UInt32 Format, Ref<Graphic::TextureFormat> Result)
+    {
+        // Values of 'VkFormat' that have an equivalent texture format.
+        static constexpr std::pair<UInt32, Graphic::TextureFormat> k_Mapping[] = {
+            {  37, Graphic::TextureFormat::RGBA8UIntNorm          }, // VK_FORMAT_R8G8B8A8_UNORM
+            {  43, Graphic::TextureFormat::RGBA8UIntNorm_sRGB     }, // VK_FORMAT_R8G8B8A8_SRGB
+            {  44, Graphic::TextureFormat::BGRA8UIntNorm          }, // VK_FORMAT_B8G8R8A8_UNORM
+            {  50, Graphic::TextureFormat::BGRA8UIntNorm_sRGB     }, // VK_FORMAT_B8G8R8A8_SRGB
+            { 131, Graphic::TextureFormat::BC1UIntNorm            }, // VK_FORMAT_BC1_RGB_UNORM_BLOCK
+            { 132, Graphic::TextureFormat::BC1UIntNorm_sRGB       }, // VK_FORMAT_BC1_RGB_SRGB_BLOCK
+            { 133, Graphic::TextureFormat::BC1UIntNorm            }, // VK_FORMAT_BC1_RGBA_UNORM_BLOCK
+            { 134, Graphic::TextureFormat::BC1UIntNorm_sRGB       }, // VK_FORMAT_BC1_RGBA_SRGB_BLOCK
+            { 135, Graphic::TextureFormat::BC2UIntNorm            }, // VK_FORMAT_BC2_UNORM_BLOCK
+            { 136, Graphic::TextureFormat::BC2UIntNorm_sRGB       }, // VK_FORMAT_BC2_SRGB_BLOCK
+            { 137, Graphic::TextureFormat::BC3UIntNorm            }, // VK_FORMAT_BC3_UNORM_BLOCK
+            { 138, Graphic::TextureFormat::BC3UIntNorm_sRGB       }, // VK_FORMAT_BC3_SRGB_BLOCK
+            { 139, Graphic::TextureFormat::BC4UIntNorm            }, // VK_FORMAT_BC4_UNORM_BLOCK
+            { 141, Graphic::TextureFormat::BC5UIntNorm            }, // VK_FORMAT_BC5_UNORM_BLOCK
+            { 145, Graphic::TextureFormat::BC7UIntNorm            }, // VK_FORMAT_BC7_UNORM_BLOCK
+            { 146, Graphic::TextureFormat::BC7UIntNorm_sRGB       }, // VK_FORMAT_BC7_SRGB_BLOCK
+            { 147, Graphic::TextureFormat::ETC2RGB8UIntNorm       }, // VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK
+            { 148, Graphic::TextureFormat::ETC2RGB8UIntNorm_sRGB  }, // VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK
+            { 151, Graphic::TextureFormat::ETC2RGBA8UIntNorm      }, // VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK
+            { 152, Graphic::TextureFormat::ETC2RGBA8UIntNorm_sRGB }, // VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK
+        };
+
+        for (const auto [Vulkan, Texture] : k_Mapping)
+        {
+            if (Vulkan == Format)
+            {
+                Result = Texture;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool KTXLoader::IsSupported(Graphic::TextureFormat Format) const
+    {
+        if (! Graphic::IsCompressed(Format))
+        {
+            return true;
+        }
+
+        const Bool IsETC2 = Format >= Graphic::TextureFormat::ETC2RGB8UIntNorm;
+        return IsETC2 ? mSupportsETC2 : mSupportsBC;
+    }
+}
\ No newline at end of file
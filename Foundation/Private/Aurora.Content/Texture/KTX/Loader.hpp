@@ -0,0 +1,93 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2025 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Aurora.Content/Loader.hpp"
+#include "Aurora.Graphic/Texture.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Content
+{
+    // Loads textures stored in a KTX2 container, whose levels are already in the layout the device samples so they
+    // are copied as they are; only 2D textures without supercompression are supported.
+    class KTXLoader final : public AbstractLoader<KTXLoader, Graphic::Texture>
+    {
+    public:
+
+        // Creates the loader, containers in a compressed family the device cannot sample are rejected.
+        KTXLoader(Bool SupportsBC, Bool SupportsETC2);
+
+        // \see Loader::GetExtensions
+        List<CStr> GetExtensions() const override
+        {
+            static List<CStr> EXTENSION_LIST = { "ktx2" };
+            return EXTENSION_LIST;
+        }
+
+        // \see AbstractLoader::Load
+        Bool OnLoad(Ref<class Service> Service, Any<Data> File, Ref<Graphic::Texture> Asset);
+
+    private:
+
+        // -=(Undocumented)=-
+        static constexpr UInt8 k_Identifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+
+        // -=(Undocumented)=-
+        struct Header
+        {
+            UInt8  Identifier[12];
+            UInt32 Format;
+            UInt32 TypeSize;
+            UInt32 Width;
+            UInt32 Height;
+            UInt32 Depth;
+            UInt32 Layers;
+            UInt32 Faces;
+            UInt32 Levels;
+            UInt32 Supercompression;
+            UInt32 DescriptorOffset;
+            UInt32 DescriptorLength;
+            UInt32 KeyValueOffset;
+            UInt32 KeyValueLength;
+            UInt64 SupercompressionOffset;
+            UInt64 SupercompressionLength;
+        };
+
+        // -=(Undocumented)=-
+        struct Level
+        {
+            UInt64 Offset;
+            UInt64 Length;
+            UInt64 UncompressedLength;
+        };
+
+    private:
+
+        // Translates a Vulkan format into its texture format, returns false if the format is not supported.
+        static Bool GetFormat(UInt32 Format, Ref<Graphic::TextureFormat> Result);
+
+        // -=(Undocumented)=-
+        Bool IsSupported(Graphic::TextureFormat Format) const;
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Bool mSupportsBC;
+        Bool mSupportsETC2;
+    };
+}
\ No newline at end of file
@@ -11,6 +11,20 @@
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
 #include "Loader.hpp"
+#include "Aurora.Content/Service.hpp"
+#include <atomic>
+
+namespace Content
+{
+    static Ptr<void> Allocate(UInt Size);
+    static Ptr<void> Reallocate(Ptr<void> Block, UInt Size, UInt NewSize);
+    static void      Free(Ptr<void> Block);
+}
+
+// Every allocation of the decoder goes through the hooks, so the image can be written straight into the caller's buffer.
+#define STBI_MALLOC(Size)                        Content::Allocate(Size)
+#define STBI_REALLOC_SIZED(Block, Size, NewSize) Content::Reallocate(Block, Size, NewSize)
+#define STBI_FREE(Block)                         Content::Free(Block)
 
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
@@ -21,29 +35,285 @@
 
 namespace Content
 {
+    // Buffer the image being decoded on a thread is written to.
+    struct Target
+    {
+        Ptr<UInt8> Texels = nullptr;
+        UInt       Size   = 0;
+        Bool       Taken  = false;
+    };
+
+    // -=(Undocumented)=-
+    static thread_local Target s_Target;
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Ptr<void> Allocate(UInt Size)
+    {
+        // The decoder allocates the final image with its exact size, hand it the target instead. Should a scratch
+        // buffer happen to share the size the image is copied into the target afterwards, which is still correct.
+        if (s_Target.Texels && ! s_Target.Taken && s_Target.Size == Size)
+        {
+            s_Target.Taken = true;
+            return s_Target.Texels;
+        }
+        return std::malloc(Size);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Ptr<void> Reallocate(Ptr<void> Block, UInt Size, UInt NewSize)
+    {
+        if (Block && Block == s_Target.Texels)
+        {
+            const Ptr<void> Result = std::malloc(NewSize);
+
+            if (Result)
+            {
+                std::memcpy(Result, Block, Min(Size, NewSize));
+                s_Target.Taken = false;
+            }
+            return Result;
+        }
+        return std::realloc(Block, NewSize);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static void Free(Ptr<void> Block)
+    {
+        if (Block && Block == s_Target.Texels)
+        {
+            s_Target.Taken = false;
+        }
+        else
+        {
+            std::free(Block);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Bool HasTransparency(CPtr<const UInt8> Texels, UInt32 Count)
+    {
+        for (UInt32 Texel = 0; Texel < Count; ++Texel)
+        {
+            if (Texels[Texel * 4 + 3] != 0xFF)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    STBLoader::STBLoader(Bool SupportsBC, Bool SupportsETC2)
+        : mSupportsBC   { SupportsBC },
+          mSupportsETC2 { SupportsETC2 }
+    {
+    }
+
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
     Bool STBLoader::OnLoad(Ref<class Service> Service, Any<Data> File, Ref<Graphic::Texture> Asset)
     {
-        SInt32 Width, Height, Channel;
+        constexpr UInt8 k_DefaultSamples = 1;
+
+        const Options Settings = ReadOptions(Service, Asset);
 
-        Ptr<stbi_uc> Image = stbi_load_from_memory(
-            File.GetData<stbi_uc>(), File.GetSize(), & Width, & Height, & Channel, STBI_rgb_alpha);
+        // Skip decoding the image entirely when an entry for the same source and options is in the cache, the
+        // texels are stored as they are uploaded so they only need to be copied back.
+        const UInt8  Flags[] = {
+            Settings.Mipmaps, static_cast<UInt8>(Settings.Filter), Settings.sRGB, static_cast<UInt8>(Settings.Compression)
+        };
+        const UInt64 Hash = XXHash64(Flags, XXHash64(File.GetSpan<UInt8>(), k_CacheVersion));
 
-        if (Image)
+        if (Data Cache = Service.FindCache("texture", Hash); Cache.HasData())
         {
-            Data Chunk(Image, Width * Height * Channel, [](Ptr<void> Data) {
-                stbi_image_free(Data);
-            });
+            Reader Archive(Cache.GetSpan<UInt8>());
 
-            constexpr UInt8 k_DefaultMipmaps = 1;
-            constexpr UInt8 k_DefaultSamples = 1;
-            Asset.Load(Graphic::TextureFormat::RGBA8UIntNorm,
-                       Graphic::TextureLayout::Source, Width, Height, k_DefaultMipmaps, k_DefaultSamples, Move(Chunk));
+            const auto              Format = Archive.ReadEnum<Graphic::TextureFormat>();
+            const UInt16            Width  = Archive.ReadUInt16();
+            const UInt16            Height = Archive.ReadUInt16();
+            const UInt8             Levels = Archive.ReadUInt8();
+            const CPtr<const UInt8> Texels = Archive.ReadBlock<const UInt8>();
+
+            if (Levels > 0 && Texels.size() == Graphic::GetTextureSize(Format, Width, Height, Levels))
+            {
+                Data Chunk(Texels.size());
+                Chunk.Copy(Texels.data(), Texels.size());
+
+                Asset.Load(Format, Graphic::TextureLayout::Source, Width, Height, Levels, k_DefaultSamples, Move(Chunk));
+                return true;
+            }
+        }
+
+        // The image is decoded straight into the beginning of its mip chain, so the levels are generated in place.
+        Data  Chunk;
+        UInt8 Levels = 1;
+
+        Image Source { .File = File.GetSpan<const UInt8>() };
+
+        const auto Destination = [&](UInt32 Index, UInt16 Width, UInt16 Height)
+        {
+            Levels = Settings.Mipmaps ? Graphic::GetMipmapCount(Width, Height) : 1;
+            Chunk  = Data(Graphic::GetTextureSize(Graphic::TextureFormat::RGBA8UIntNorm, Width, Height, Levels));
+            return Chunk.GetData<UInt8>();
+        };
 
+        if (Decode(Service, CPtr<Image>(& Source, 1), Destination) > 0)
+        {
+            const UInt16 Width  = Source.Width;
+            const UInt16 Height = Source.Height;
+
+            if (Levels > 1)
+            {
+                Graphic::GenerateMipmaps(Chunk.GetData<UInt8>(), Width, Height, Levels, Settings.Filter, Settings.sRGB);
+            }
+
+            const Graphic::TextureFormat Format = Graphic::GetCompressedFormat(
+                Settings.Compression, HasTransparency(Chunk.GetSpan<const UInt8>(), Width * Height), Settings.sRGB);
+
+            if (Settings.Compression != Graphic::TextureCompression::None)
+            {
+                Chunk = Graphic::Compress(Chunk.GetSpan<const UInt8>(), Width, Height, Levels, Format);
+            }
+
+            Writer Archive(Chunk.GetSize() + 16);
+            Archive.WriteEnum(Format);
+            Archive.WriteUInt16(Width);
+            Archive.WriteUInt16(Height);
+            Archive.WriteUInt8(Levels);
+            Archive.WriteBlock(Chunk.GetSpan<const UInt8>());
+            Service.SaveCache("texture", Hash, Archive.GetData());
+
+            Asset.Load(Format, Graphic::TextureLayout::Source, Width, Height, Levels, k_DefaultSamples, Move(Chunk));
             return true;
         }
         return false;
     }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt32 STBLoader::Decode(Ref<class Service> Service, CPtr<Image> Images, ConstRef<Allocator> Allocate)
+    {
+        if (Images.empty())
+        {
+            return 0;
+        }
+
+        // Read every header first, so that the destinations are handed out in order before any image is decoded.
+        for (UInt32 Index = 0; Index < Images.size(); ++Index)
+        {
+            Ref<Image> Image = Images[Index];
+
+            SInt32 Width, Height, Channel;
+
+            if (stbi_info_from_memory(Image.File.data(), Image.File.size(), & Width, & Height, & Channel)
+                && Width <= UINT16_MAX && Height <= UINT16_MAX)
+            {
+                Image.Width  = Width;
+                Image.Height = Height;
+                Image.Texels = Allocate(Index, Image.Width, Image.Height);
+            }
+        }
+
+        Atomic<UInt32> Decoded = 0;
+
+        // The calling thread decodes too, a single image is therefore decoded without involving the pool.
+        Service.Dispatch(Images.size(), [&](UInt32 Index)
+        {
+            if (Images[Index].Texels && Decode(Images[Index]))
+            {
+                ++Decoded;
+            }
+        });
+        return Decoded;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool STBLoader::Decode(Ref<Image> Image)
+    {
+        s_Target = Target { Image.Texels, static_cast<UInt>(Image.Width) * Image.Height * k_Channels };
+
+        SInt32 Width, Height, Channel;
+
+        // The image is always expanded to RGBA, regardless of the channels stored in the file.
+        const Ptr<stbi_uc> Texels = stbi_load_from_memory(
+            Image.File.data(), Image.File.size(), & Width, & Height, & Channel, STBI_rgb_alpha);
+
+        const UInt Size = s_Target.Size;
+        s_Target = Target { };
+
+        if (Texels && Texels != Image.Texels)
+        {
+            std::memcpy(Image.Texels, Texels, Size);
+            stbi_image_free(Texels);
+        }
+
+        Image.Decoded = (Texels != nullptr);
+        return Image.Decoded;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    STBLoader::Options STBLoader::ReadOptions(Ref<class Service> Service, Ref<Resource> Asset) const
+    {
+        ConstRef<Uri> Key = Asset.GetKey();
+        Options       Settings;
+
+        if (const Data Sidecar = Service.Read(Asset, Format("{}{}", Key.GetUrlWithoutFragment(), k_Sidecar)); Sidecar.HasData())
+        {
+            TOMLParser        Parser(Sidecar.GetText());
+            const TOMLSection Texture = Parser.GetSection("Texture");
+
+            Settings.Mipmaps = Texture.GetBool("Mipmaps", Settings.Mipmaps);
+            Settings.Filter  = CastEnum(Texture.GetString("Filter"), Settings.Filter);
+            Settings.sRGB    = Texture.GetBool("sRGB", Settings.sRGB);
+
+            Settings.Compression = Resolve(CastEnum(Texture.GetString("Compression"), Settings.Compression));
+        }
+
+        if (Key.GetFragment() == k_NoMipmaps)
+        {
+            Settings.Mipmaps = false;
+        }
+        return Settings;
+    }
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Graphic::TextureCompression STBLoader::Resolve(Graphic::TextureCompression Compression) const
+    {
+        switch (Compression)
+        {
+        case Graphic::TextureCompression::BC1:
+        case Graphic::TextureCompression::BC3:
+        case Graphic::TextureCompression::BC7:
+            if (mSupportsBC)
+            {
+                return Compression;
+            }
+            return mSupportsETC2 ? Graphic::TextureCompression::ETC2 : Graphic::TextureCompression::None;
+        case Graphic::TextureCompression::ETC2:
+            if (mSupportsETC2)
+            {
+                return Compression;
+            }
+            return mSupportsBC ? Graphic::TextureCompression::BC7 : Graphic::TextureCompression::None;
+        default:
+            return Graphic::TextureCompression::None;
+        }
+    }
 }
\ No newline at end of file
@@ -13,6 +13,8 @@
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
 #include "Aurora.Content/Loader.hpp"
+#include "Aurora.Graphic/Compression.hpp"
+#include "Aurora.Graphic/Mipmap.hpp"
 #include "Aurora.Graphic/Texture.hpp"
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -21,11 +23,14 @@
 
 namespace Content
 {
-    // -=(Undocumented)=-
+    // Loads PNG, BMP and JPEG images, decoding them with 'stb_image' into RGBA8 textures.
     class STBLoader final : public AbstractLoader<STBLoader, Graphic::Texture>
     {
     public:
 
+        // Creates the loader, compressed textures are only produced in the families the device can sample.
+        STBLoader(Bool SupportsBC, Bool SupportsETC2);
+
         // \see Loader::GetExtensions
         List<CStr> GetExtensions() const override
         {
@@ -35,5 +40,67 @@ namespace Content
 
         // \see AbstractLoader::Load
         Bool OnLoad(Ref<class Service> Service, Any<Data> File, Ref<Graphic::Texture> Asset);
+
+    public:
+
+        // An image to decode with \see Decode, the size and the outcome are filled in by the decoder.
+        struct Image
+        {
+            CPtr<const UInt8> File;
+            UInt16            Width   = 0;
+            UInt16            Height  = 0;
+            Ptr<UInt8>        Texels  = nullptr;
+            Bool              Decoded = false;
+        };
+
+        // Returns where an image is decoded to, at least 'Width * Height * 4' bytes, or null to skip the image.
+        using Allocator = FPtr<Ptr<UInt8>(UInt32 Index, UInt16 Width, UInt16 Height)>;
+
+        // Decodes every image as RGBA8 into the buffers given by the allocator, which is invoked in order on the calling
+        // thread before any image is decoded so it can hand out slices of a single staging block. The images are
+        // decoded in parallel on the service's worker pool; returns the number of images decoded.
+        static UInt32 Decode(Ref<class Service> Service, CPtr<Image> Images, ConstRef<Allocator> Allocate);
+
+    private:
+
+        // Version of the cached texture layout, must be bumped whenever the decoded form changes.
+        static constexpr UInt64 k_CacheVersion = 3;
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_Channels     = 4;
+
+        // Extension appended to the image's filename to find its sidecar, a TOML file with a 'Texture' section.
+        static constexpr CStr   k_Sidecar      = ".meta";
+
+        // Fragment that disables the mip chain of a single request, such as 'Sprite.png#NoMipmaps'.
+        static constexpr CStr   k_NoMipmaps    = "NoMipmaps";
+
+        // -=(Undocumented)=-
+        struct Options
+        {
+            Bool                        Mipmaps     = true;
+            Graphic::MipmapFilter       Filter      = Graphic::MipmapFilter::Kaiser;
+            Bool                        sRGB        = false;
+            Graphic::TextureCompression Compression = Graphic::TextureCompression::None;
+        };
+
+    private:
+
+        // -=(Undocumented)=-
+        static Bool Decode(Ref<Image> Image);
+
+        // -=(Undocumented)=-
+        Options ReadOptions(Ref<class Service> Service, Ref<Resource> Asset) const;
+
+        // Returns the compression to use on this device, swapping the family when the requested one is not supported.
+        Graphic::TextureCompression Resolve(Graphic::TextureCompression Compression) const;
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Bool mSupportsBC;
+        Bool mSupportsETC2;
     };
 }
\ No newline at end of file
@@ -169,6 +169,12 @@ namespace Graphic
             { DXGI_FORMAT_BC3_UNORM_SRGB,       DXGI_FORMAT_BC3_UNORM_SRGB,             DXGI_FORMAT_UNKNOWN              }, // TextureFormat::BC3UIntNorm_sRGB
             { DXGI_FORMAT_BC4_UNORM,            DXGI_FORMAT_BC4_UNORM,                  DXGI_FORMAT_UNKNOWN              }, // TextureFormat::BC4UIntNorm
             { DXGI_FORMAT_BC5_UNORM,            DXGI_FORMAT_BC5_UNORM,                  DXGI_FORMAT_UNKNOWN              }, // TextureFormat::BC5UIntNorm
+            { DXGI_FORMAT_BC7_UNORM,            DXGI_FORMAT_BC7_UNORM,                  DXGI_FORMAT_UNKNOWN              }, // TextureFormat::BC7UIntNorm
+            { DXGI_FORMAT_BC7_UNORM_SRGB,       DXGI_FORMAT_BC7_UNORM_SRGB,             DXGI_FORMAT_UNKNOWN              }, // TextureFormat::BC7UIntNorm_sRGB
+            { DXGI_FORMAT_UNKNOWN,              DXGI_FORMAT_UNKNOWN,                    DXGI_FORMAT_UNKNOWN              }, // TextureFormat::ETC2RGB8UIntNorm
+            { DXGI_FORMAT_UNKNOWN,              DXGI_FORMAT_UNKNOWN,                    DXGI_FORMAT_UNKNOWN              }, // TextureFormat::ETC2RGB8UIntNorm_sRGB
+            { DXGI_FORMAT_UNKNOWN,              DXGI_FORMAT_UNKNOWN,                    DXGI_FORMAT_UNKNOWN              }, // TextureFormat::ETC2RGBA8UIntNorm
+            { DXGI_FORMAT_UNKNOWN,              DXGI_FORMAT_UNKNOWN,                    DXGI_FORMAT_UNKNOWN              }, // TextureFormat::ETC2RGBA8UIntNorm_sRGB
             { DXGI_FORMAT_R8_SINT,              DXGI_FORMAT_R8_SINT,                    DXGI_FORMAT_UNKNOWN              }, // TextureFormat::R8SInt
             { DXGI_FORMAT_R8_SNORM,             DXGI_FORMAT_R8_SNORM,                   DXGI_FORMAT_UNKNOWN              }, // TextureFormat::R8SIntNorm
             { DXGI_FORMAT_R8_UINT,              DXGI_FORMAT_R8_UINT,                    DXGI_FORMAT_UNKNOWN              }, // TextureFormat::R8UInt
@@ -224,70 +230,6 @@ namespace Graphic
 
     static auto Fill(ConstPtr<UInt8> Data, UInt8 Layer, UInt16 Width, UInt16 Height, TextureFormat Layout)
     {
-        constexpr static UInt8 kMapping[] = {
-            4,      // TextureFormat::BC1UIntNorm
-            4,      // TextureFormat::BC1UIntNorm_sRGB
-            8,      // TextureFormat::BC2UIntNorm
-            8,      // TextureFormat::BC2UIntNorm_sRGB
-            8,      // TextureFormat::BC3UIntNorm
-            8,      // TextureFormat::BC3UIntNorm_sRGB
-            4,      // TextureFormat::BC4UIntNorm
-            8,      // TextureFormat::BC5UIntNorm
-            8,      // TextureFormat::BC7UIntNorm
-            8,      // TextureFormat::BC7UIntNorm_sRGB
-            8,      // TextureFormat::R8SInt
-            8,      // TextureFormat::R8SIntNorm
-            8,      // TextureFormat::R8UInt
-            8,      // TextureFormat::R8UIntNorm
-            16,     // TextureFormat::R16SInt
-            16,     // TextureFormat::R16SIntNorm
-            16,     // TextureFormat::R16UInt
-            16,     // TextureFormat::R16UIntNorm
-            16,     // TextureFormat::R16Float
-            32,     // TextureFormat::R32SInt
-            32,     // TextureFormat::R32UInt
-            32,     // TextureFormat::R32Float
-            16,     // TextureFormat::RG8SInt
-            16,     // TextureFormat::RG8SIntNorm
-            16,     // TextureFormat::RG8UInt
-            16,     // TextureFormat::RG8UIntNorm
-            32,     // TextureFormat::RG16SInt
-            32,     // TextureFormat::RG16SIntNorm
-            32,     // TextureFormat::RG16UInt
-            32,     // TextureFormat::RG16UIntNorm
-            32,     // TextureFormat::RG16Float
-            64,     // TextureFormat::RG32SInt
-            64,     // TextureFormat::RG32UInt
-            64,     // TextureFormat::RG32Float
-            96,     // TextureFormat::RGB32SInt
-            96,     // TextureFormat::RGB32UInt
-            96,     // TextureFormat::RGB32Float
-            32,     // TextureFormat::RGBA8SInt
-            32,     // TextureFormat::RGBA8SIntNorm
-            32,     // TextureFormat::RGBA8UInt
-            32,     // TextureFormat::RGBA8UIntNorm
-            32,     // TextureFormat::RGBA8UIntNorm_sRGB
-            32,     // TextureFormat::BGRA8UIntNorm
-            32,     // TextureFormat::BGRA8UIntNorm_sRGB
-            64,     // TextureFormat::RGBA16SInt
-            64,     // TextureFormat::RGBA16SIntNorm
-            64,     // TextureFormat::RGBA16UInt
-            64,     // TextureFormat::RGBA16UIntNorm
-            64,     // TextureFormat::RGBA16Float
-            128,    // TextureFormat::RGBA32SInt
-            128,    // TextureFormat::RGBA32UInt
-            128,    // TextureFormat::RGBA32Float
-            16,     // TextureFormat::D16Float
-            32,     // TextureFormat::D24Float
-            32,     // TextureFormat::D32Float
-            32,     // TextureFormat::D16X0UIntNorm
-            32,     // TextureFormat::D24X0UIntNorm
-            32,     // TextureFormat::D24S8UIntNorm
-            32,     // TextureFormat::D32X0UIntNorm
-        };
-
-        const UInt32 Depth = kMapping[CastEnum(Layout)];
-
         if (Data)
         {
             static D3D11_SUBRESOURCE_DATA Content[k_MaxMipmap];
@@ -295,10 +237,10 @@ namespace Graphic
             for (UInt32 Level = 0; Level < Layer; ++Level)
             {
                 Content[Level].pSysMem          = Data;
-                Content[Level].SysMemPitch      = Width * (Depth / 8);
+                Content[Level].SysMemPitch      = GetTexturePitch(Layout, Width);
                 Content[Level].SysMemSlicePitch = 0;
 
-                Data  += Width * Depth * Height;
+                Data  += GetTextureSize(Layout, Width, Height);
                 Width  = Core::Max(1, Width  >> 1);
                 Height = Core::Max(1, Height >> 1);
             }
@@ -572,6 +514,15 @@ namespace Graphic
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+    void D3D11Driver::SetPipelineCache(Any<PipelineCache> Cache)
+    {
+        // Bytecode handed to the driver is already compiled and cached by the content pipeline, and creating a
+        // shader from it is cheap enough that there is nothing else worth persisting.
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
     void D3D11Driver::CreateBuffer(Object ID, Usage Type, Bool Immutable, ConstPtr<UInt8> Data, UInt32 Length)
     {
         const D3D11_BIND_FLAG   Binding    = As(Type);
@@ -677,7 +628,7 @@ namespace Graphic
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-    void D3D11Driver::CreatePipeline(Object ID, CPtr<const UInt8> Vertex, CPtr<const UInt8> Fragment, CPtr<const UInt8> Geometry, ConstRef<Descriptor> Properties)
+    void D3D11Driver::CreatePipeline(Object ID, CPtr<const UInt8> Vertex, CPtr<const UInt8> Fragment, CPtr<const UInt8> Geometry, CPtr<const UInt8> Cache, ConstRef<Descriptor> Properties)
     {
         Ref<D3D11Pipeline> Pipeline = mPipelines[ID];
 
@@ -1142,10 +1093,12 @@ namespace Graphic
         case D3D_FEATURE_LEVEL_12_1:
         case D3D_FEATURE_LEVEL_12_0:
             mCapabilities.Language = Language::Version_6;
+            mCapabilities.BC       = true;
             break;
         case D3D_FEATURE_LEVEL_11_1:
         case D3D_FEATURE_LEVEL_11_0:
             mCapabilities.Language = Language::Version_5;
+            mCapabilities.BC       = true;     // BC7 requires feature level 11_0.
             break;
         case D3D_FEATURE_LEVEL_10_1:
         case D3D_FEATURE_LEVEL_10_0:
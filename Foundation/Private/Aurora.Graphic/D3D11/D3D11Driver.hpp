@@ -36,6 +36,9 @@ namespace Graphic
         // \see Driver::GetCapabilities
         ConstRef<Capabilities> GetCapabilities() const override;
 
+        // \see Driver::SetPipelineCache
+        void SetPipelineCache(Any<PipelineCache> Cache) override;
+
         // \see Driver::CreateBuffer
         void CreateBuffer(Object ID, Usage Type, Bool Immutable, ConstPtr<UInt8> Data, UInt32 Length) override;
 
@@ -55,7 +58,7 @@ namespace Graphic
         void DeletePass(Object ID) override;
 
         // \see Driver::CreatePipeline
-        void CreatePipeline(Object ID, CPtr<const UInt8> Vertex, CPtr<const UInt8> Fragment, CPtr<const UInt8> Geometry, ConstRef<Descriptor> Properties) override;
+        void CreatePipeline(Object ID, CPtr<const UInt8> Vertex, CPtr<const UInt8> Fragment, CPtr<const UInt8> Geometry, CPtr<const UInt8> Cache, ConstRef<Descriptor> Properties) override;
 
         // \see Driver::DeletePipeline
         void DeletePipeline(Object ID) override;
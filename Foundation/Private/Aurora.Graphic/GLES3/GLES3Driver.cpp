@@ -13,6 +13,12 @@
 #define GLAD_GL_IMPLEMENTATION
 #include "GLES3Driver.hpp"
 
+// The loader was not generated with BPTC, both extensions share the same tokens.
+#ifndef   GL_COMPRESSED_RGBA_BPTC_UNORM_EXT
+    #define GL_COMPRESSED_RGBA_BPTC_UNORM_EXT       0x8E8C
+    #define GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM_EXT 0x8E8D
+#endif // GL_COMPRESSED_RGBA_BPTC_UNORM_EXT
+
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 // [   CODE   ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -135,64 +141,69 @@ namespace Graphic
     template<UInt Data>
     static auto As(TextureFormat Value)
     {
-        constexpr static std::tuple<UInt, UInt, UInt, UInt> k_Mapping[] =
+        constexpr static std::tuple<UInt, UInt, UInt> k_Mapping[] =
         {
-            //            Internal                                  Format                     Type               Depth
-            { GL_COMPRESSED_RGBA_S3TC_DXT1_EXT,       GL_COMPRESSED_RGBA_S3TC_DXT1_EXT,       GL_NONE,              64 }, // TextureFormat::BC1UIntNorm
-            { GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT, GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT, GL_NONE,              64 }, // TextureFormat::BC1UIntNorm_sRGB
-            { GL_COMPRESSED_RGBA_S3TC_DXT3_EXT,       GL_COMPRESSED_RGBA_S3TC_DXT3_EXT,       GL_NONE,             128 }, // TextureFormat::BC2UIntNorm
-            { GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT, GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT, GL_NONE,             128 }, // TextureFormat::BC2UIntNorm_sRGB
-            { GL_COMPRESSED_RGBA_S3TC_DXT5_EXT,       GL_COMPRESSED_RGBA_S3TC_DXT5_EXT,       GL_NONE,             128 }, // TextureFormat::BC3UIntNorm
-            { GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT, GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT, GL_NONE,             128 }, // TextureFormat::BC3UIntNorm_sRGB
-            { GL_COMPRESSED_RED_RGTC1_EXT,            GL_COMPRESSED_RED_RGTC1_EXT,            GL_NONE,              64 }, // TextureFormat::BC4UIntNorm
-            { GL_COMPRESSED_RED_GREEN_RGTC2_EXT,      GL_COMPRESSED_RED_GREEN_RGTC2_EXT,      GL_NONE,             128 }, // TextureFormat::BC5UIntNorm
-            { GL_R8I,                                 GL_RED,                                 GL_BYTE,               8 }, // TextureFormat::R8SInt
-            { GL_R8_SNORM,                            GL_RED,                                 GL_BYTE,               8 }, // TextureFormat::R8SIntNorm
-            { GL_R8UI,                                GL_RED_INTEGER,                         GL_UNSIGNED_BYTE,      8 }, // TextureFormat::R8UInt
-            { GL_R8,                                  GL_RED,                                 GL_UNSIGNED_BYTE,      8 }, // TextureFormat::R8UIntNorm
-            { GL_R16I,                                GL_RED,                                 GL_SHORT,             16 }, // TextureFormat::R16SInt
-            { GL_R16_SNORM,                           GL_RED,                                 GL_SHORT,             16 }, // TextureFormat::R16SIntNorm
-            { GL_R16UI,                               GL_RED_INTEGER,                         GL_UNSIGNED_SHORT,    16 }, // TextureFormat::R16UInt
-            { GL_R16,                                 GL_RED,                                 GL_UNSIGNED_SHORT,    16 }, // TextureFormat::R16UIntNorm
-            { GL_R16F,                                GL_RED,                                 GL_HALF_FLOAT,        16 }, // TextureFormat::R16Float
-            { GL_R32I,                                GL_RED,                                 GL_INT,               32 }, // TextureFormat::R32SInt
-            { GL_R32UI,                               GL_RED_INTEGER,                         GL_UNSIGNED_INT,      32 }, // TextureFormat::R32UInt
-            { GL_R32F,                                GL_RED,                                 GL_FLOAT,             32 }, // TextureFormat::R32Float
-            { GL_RG8,                                 GL_RG,                                  GL_UNSIGNED_BYTE,     16 }, // TextureFormat::RG8SInt
-            { GL_RG8_SNORM,                           GL_RG,                                  GL_BYTE,              16 }, // TextureFormat::RG8SIntNorm
-            { GL_RG8UI,                               GL_RG_INTEGER,                          GL_UNSIGNED_BYTE,     16 }, // TextureFormat::RG8UInt
-            { GL_RG8,                                 GL_RG,                                  GL_UNSIGNED_BYTE,     16 }, // TextureFormat::RG8UIntNorm
-            { GL_RG16I,                               GL_RG,                                  GL_SHORT,             32 }, // TextureFormat::RG16SInt
-            { GL_RG16_SNORM,                          GL_RG,                                  GL_SHORT,             32 }, // TextureFormat::RG16SIntNorm
-            { GL_RG16UI,                              GL_RG_INTEGER,                          GL_UNSIGNED_SHORT,    32 }, // TextureFormat::RG16UInt
-            { GL_RG16,                                GL_RG,                                  GL_UNSIGNED_SHORT,    32 }, // TextureFormat::RG16UIntNorm
-            { GL_RG16F,                               GL_RG,                                  GL_HALF_FLOAT,        32 }, // TextureFormat::RG16Float
-            { GL_RG32I,                               GL_RG,                                  GL_INT,               64 }, // TextureFormat::RG32SInt
-            { GL_RG32UI,                              GL_RG_INTEGER,                          GL_UNSIGNED_INT,      64 }, // TextureFormat::RG32UInt
-            { GL_RG32F,                               GL_RG,                                  GL_FLOAT,             64 }, // TextureFormat::RG32Float
-            { GL_RGB32I,                              GL_RGB,                                 GL_INT,               96 }, // TextureFormat::RGB32SInt
-            { GL_RGB32UI,                             GL_RGB_INTEGER,                         GL_UNSIGNED_INT,      96 }, // TextureFormat::RGB32UInt
-            { GL_RGB32F,                              GL_RGB,                                 GL_FLOAT,             96 }, // TextureFormat::RGB32Float
-            { GL_RGBA8I,                              GL_RGBA,                                GL_INT,               32 }, // TextureFormat::RGBA8SInt
-            { GL_RGBA8_SNORM,                         GL_RGBA,                                GL_BYTE,              32 }, // TextureFormat::RGBA8SIntNorm
-            { GL_RGBA8UI,                             GL_RGBA_INTEGER,                        GL_UNSIGNED_BYTE,     32 }, // TextureFormat::RGBA8UInt
-            { GL_RGBA8,                               GL_RGBA,                                GL_UNSIGNED_BYTE,     32 }, // TextureFormat::RGBA8UIntNorm
-            { GL_SRGB8_ALPHA8,                        GL_RGBA,                                GL_UNSIGNED_BYTE,     32 }, // TextureFormat::RGBA8UIntNorm_sRGB
-            { GL_BGRA8_EXT,                           GL_BGRA,                                GL_UNSIGNED_BYTE,     32 }, // TextureFormat::BGRA8UIntNorm
-            { GL_SRGB8_ALPHA8,                        GL_BGRA,                                GL_UNSIGNED_BYTE,     32 }, // TextureFormat::BGRA8UIntNorm_sRGB
-            { GL_RGBA16I,                             GL_RGBA,                                GL_SHORT,             64 }, // TextureFormat::RGBA16SInt
-            { GL_RGBA16_SNORM,                        GL_RGBA,                                GL_SHORT,             64 }, // TextureFormat::RGBA16SIntNorm
-            { GL_RGBA16UI,                            GL_RGBA_INTEGER,                        GL_UNSIGNED_SHORT,    64 }, // TextureFormat::RGBA16UInt
-            { GL_RGBA16,                              GL_RGBA,                                GL_UNSIGNED_SHORT,    64 }, // TextureFormat::RGBA16UIntNorm
-            { GL_RGBA16F,                             GL_RGBA,                                GL_HALF_FLOAT,        64 }, // TextureFormat::RGBA16Float
-            { GL_RGBA32I,                             GL_RGBA,                                GL_INT,              128 }, // TextureFormat::RGBA32SInt
-            { GL_RGBA32UI,                            GL_RGBA_INTEGER,                        GL_UNSIGNED_INT,     128 }, // TextureFormat::RGBA32UInt
-            { GL_RGBA32F,                             GL_RGBA,                                GL_FLOAT,            128 }, // TextureFormat::RGBA32Float
-            { GL_DEPTH_COMPONENT32F,                  GL_DEPTH_COMPONENT,                     GL_FLOAT,             32 }, // TextureFormat::D32Float
-            { GL_DEPTH_COMPONENT16,                   GL_DEPTH_COMPONENT,                     GL_UNSIGNED_SHORT,    16 }, // TextureFormat::D16X0UIntNorm
-            { GL_DEPTH_COMPONENT24,                   GL_DEPTH_COMPONENT,                     GL_UNSIGNED_INT,      24 }, // TextureFormat::D24X0UIntNorm
-            { GL_DEPTH24_STENCIL8,                    GL_DEPTH_STENCIL,                       GL_UNSIGNED_INT_24_8, 32 }, // TextureFormat::D24S8UIntNorm
-            { GL_DEPTH_COMPONENT32,                   GL_DEPTH_COMPONENT,                     GL_UNSIGNED_INT,      32 }, // TextureFormat::D32X0UIntNorm
+            // Internal                               Format                                   Type
+            { GL_COMPRESSED_RGBA_S3TC_DXT1_EXT,        GL_COMPRESSED_RGBA_S3TC_DXT1_EXT,        GL_NONE                           }, // TextureFormat::BC1UIntNorm
+            { GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT,  GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT,  GL_NONE                           }, // TextureFormat::BC1UIntNorm_sRGB
+            { GL_COMPRESSED_RGBA_S3TC_DXT3_EXT,        GL_COMPRESSED_RGBA_S3TC_DXT3_EXT,        GL_NONE                           }, // TextureFormat::BC2UIntNorm
+            { GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT,  GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT,  GL_NONE                           }, // TextureFormat::BC2UIntNorm_sRGB
+            { GL_COMPRESSED_RGBA_S3TC_DXT5_EXT,        GL_COMPRESSED_RGBA_S3TC_DXT5_EXT,        GL_NONE                           }, // TextureFormat::BC3UIntNorm
+            { GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT,  GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT,  GL_NONE                           }, // TextureFormat::BC3UIntNorm_sRGB
+            { GL_COMPRESSED_RED_RGTC1_EXT,             GL_COMPRESSED_RED_RGTC1_EXT,             GL_NONE                           }, // TextureFormat::BC4UIntNorm
+            { GL_COMPRESSED_RED_GREEN_RGTC2_EXT,       GL_COMPRESSED_RED_GREEN_RGTC2_EXT,       GL_NONE                           }, // TextureFormat::BC5UIntNorm
+            { GL_COMPRESSED_RGBA_BPTC_UNORM_EXT,       GL_COMPRESSED_RGBA_BPTC_UNORM_EXT,       GL_NONE                           }, // TextureFormat::BC7UIntNorm
+            { GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM_EXT, GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM_EXT, GL_NONE                           }, // TextureFormat::BC7UIntNorm_sRGB
+            { GL_COMPRESSED_RGB8_ETC2,                 GL_COMPRESSED_RGB8_ETC2,                 GL_NONE                           }, // TextureFormat::ETC2RGB8UIntNorm
+            { GL_COMPRESSED_SRGB8_ETC2,                GL_COMPRESSED_SRGB8_ETC2,                GL_NONE                           }, // TextureFormat::ETC2RGB8UIntNorm_sRGB
+            { GL_COMPRESSED_RGBA8_ETC2_EAC,            GL_COMPRESSED_RGBA8_ETC2_EAC,            GL_NONE                           }, // TextureFormat::ETC2RGBA8UIntNorm
+            { GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC,     GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC,     GL_NONE                           }, // TextureFormat::ETC2RGBA8UIntNorm_sRGB
+            { GL_R8I,                                  GL_RED,                                  GL_BYTE                           }, // TextureFormat::R8SInt
+            { GL_R8_SNORM,                             GL_RED,                                  GL_BYTE                           }, // TextureFormat::R8SIntNorm
+            { GL_R8UI,                                 GL_RED_INTEGER,                          GL_UNSIGNED_BYTE                  }, // TextureFormat::R8UInt
+            { GL_R8,                                   GL_RED,                                  GL_UNSIGNED_BYTE                  }, // TextureFormat::R8UIntNorm
+            { GL_R16I,                                 GL_RED,                                  GL_SHORT                          }, // TextureFormat::R16SInt
+            { GL_R16_SNORM,                            GL_RED,                                  GL_SHORT                          }, // TextureFormat::R16SIntNorm
+            { GL_R16UI,                                GL_RED_INTEGER,                          GL_UNSIGNED_SHORT                 }, // TextureFormat::R16UInt
+            { GL_R16,                                  GL_RED,                                  GL_UNSIGNED_SHORT                 }, // TextureFormat::R16UIntNorm
+            { GL_R16F,                                 GL_RED,                                  GL_HALF_FLOAT                     }, // TextureFormat::R16Float
+            { GL_R32I,                                 GL_RED,                                  GL_INT                            }, // TextureFormat::R32SInt
+            { GL_R32UI,                                GL_RED_INTEGER,                          GL_UNSIGNED_INT                   }, // TextureFormat::R32UInt
+            { GL_R32F,                                 GL_RED,                                  GL_FLOAT                          }, // TextureFormat::R32Float
+            { GL_RG8,                                  GL_RG,                                   GL_UNSIGNED_BYTE                  }, // TextureFormat::RG8SInt
+            { GL_RG8_SNORM,                            GL_RG,                                   GL_BYTE                           }, // TextureFormat::RG8SIntNorm
+            { GL_RG8UI,                                GL_RG_INTEGER,                           GL_UNSIGNED_BYTE                  }, // TextureFormat::RG8UInt
+            { GL_RG8,                                  GL_RG,                                   GL_UNSIGNED_BYTE                  }, // TextureFormat::RG8UIntNorm
+            { GL_RG16I,                                GL_RG,                                   GL_SHORT                          }, // TextureFormat::RG16SInt
+            { GL_RG16_SNORM,                           GL_RG,                                   GL_SHORT                          }, // TextureFormat::RG16SIntNorm
+            { GL_RG16UI,                               GL_RG_INTEGER,                           GL_UNSIGNED_SHORT                 }, // TextureFormat::RG16UInt
+            { GL_RG16,                                 GL_RG,                                   GL_UNSIGNED_SHORT                 }, // TextureFormat::RG16UIntNorm
+            { GL_RG16F,                                GL_RG,                                   GL_HALF_FLOAT                     }, // TextureFormat::RG16Float
+            { GL_RG32I,                                GL_RG,                                   GL_INT                            }, // TextureFormat::RG32SInt
+            { GL_RG32UI,                               GL_RG_INTEGER,                           GL_UNSIGNED_INT                   }, // TextureFormat::RG32UInt
+            { GL_RG32F,                                GL_RG,                                   GL_FLOAT                          }, // TextureFormat::RG32Float
+            { GL_RGB32I,                               GL_RGB,                                  GL_INT                            }, // TextureFormat::RGB32SInt
+            { GL_RGB32UI,                              GL_RGB_INTEGER,                          GL_UNSIGNED_INT                   }, // TextureFormat::RGB32UInt
+            { GL_RGB32F,                               GL_RGB,                                  GL_FLOAT                          }, // TextureFormat::RGB32Float
+            { GL_RGBA8I,                               GL_RGBA,                                 GL_INT                            }, // TextureFormat::RGBA8SInt
+            { GL_RGBA8_SNORM,                          GL_RGBA,                                 GL_BYTE                           }, // TextureFormat::RGBA8SIntNorm
+            { GL_RGBA8UI,                              GL_RGBA_INTEGER,                         GL_UNSIGNED_BYTE                  }, // TextureFormat::RGBA8UInt
+            { GL_RGBA8,                                GL_RGBA,                                 GL_UNSIGNED_BYTE                  }, // TextureFormat::RGBA8UIntNorm
+            { GL_SRGB8_ALPHA8,                         GL_RGBA,                                 GL_UNSIGNED_BYTE                  }, // TextureFormat::RGBA8UIntNorm_sRGB
+            { GL_BGRA8_EXT,                            GL_BGRA,                                 GL_UNSIGNED_BYTE                  }, // TextureFormat::BGRA8UIntNorm
+            { GL_SRGB8_ALPHA8,                         GL_BGRA,                                 GL_UNSIGNED_BYTE                  }, // TextureFormat::BGRA8UIntNorm_sRGB
+            { GL_RGBA16I,                              GL_RGBA,                                 GL_SHORT                          }, // TextureFormat::RGBA16SInt
+            { GL_RGBA16_SNORM,                         GL_RGBA,                                 GL_SHORT                          }, // TextureFormat::RGBA16SIntNorm
+            { GL_RGBA16UI,                             GL_RGBA_INTEGER,                         GL_UNSIGNED_SHORT                 }, // TextureFormat::RGBA16UInt
+            { GL_RGBA16,                               GL_RGBA,                                 GL_UNSIGNED_SHORT                 }, // TextureFormat::RGBA16UIntNorm
+            { GL_RGBA16F,                              GL_RGBA,                                 GL_HALF_FLOAT                     }, // TextureFormat::RGBA16Float
+            { GL_RGBA32I,                              GL_RGBA,                                 GL_INT                            }, // TextureFormat::RGBA32SInt
+            { GL_RGBA32UI,                             GL_RGBA_INTEGER,                         GL_UNSIGNED_INT                   }, // TextureFormat::RGBA32UInt
+            { GL_RGBA32F,                              GL_RGBA,                                 GL_FLOAT                          }, // TextureFormat::RGBA32Float
+            { GL_DEPTH_COMPONENT32F,                   GL_DEPTH_COMPONENT,                      GL_FLOAT                          }, // TextureFormat::D32Float
+            { GL_DEPTH_COMPONENT16,                    GL_DEPTH_COMPONENT,                      GL_UNSIGNED_SHORT                 }, // TextureFormat::D16X0UIntNorm
+            { GL_DEPTH24_STENCIL8,                     GL_DEPTH_STENCIL,                        GL_UNSIGNED_INT_24_8              }, // TextureFormat::D24S8UIntNorm
+            { GL_DEPTH32F_STENCIL8,                    GL_DEPTH_STENCIL,                        GL_FLOAT_32_UNSIGNED_INT_24_8_REV }, // TextureFormat::D32S8UIntNorm
         };
         return std::get<Data>(k_Mapping[CastEnum(Value)]);
     }
@@ -272,6 +283,61 @@ namespace Graphic
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+    static Bool IsSampler(GLenum Type)
+    {
+        switch (Type)
+        {
+        case GL_SAMPLER_2D:
+        case GL_SAMPLER_3D:
+        case GL_SAMPLER_CUBE:
+        case GL_SAMPLER_2D_SHADOW:
+        case GL_SAMPLER_2D_ARRAY:
+        case GL_SAMPLER_2D_ARRAY_SHADOW:
+        case GL_SAMPLER_CUBE_SHADOW:
+        case GL_INT_SAMPLER_2D:
+        case GL_INT_SAMPLER_3D:
+        case GL_INT_SAMPLER_CUBE:
+        case GL_INT_SAMPLER_2D_ARRAY:
+        case GL_UNSIGNED_INT_SAMPLER_2D:
+        case GL_UNSIGNED_INT_SAMPLER_3D:
+        case GL_UNSIGNED_INT_SAMPLER_CUBE:
+        case GL_UNSIGNED_INT_SAMPLER_2D_ARRAY:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static SInt32 GetRegister(CStr Name)
+    {
+        // The register is given by the digits the name ends with (such as 'Global0' or 'ColorTexture1').
+        UInt Offset = Name.size();
+
+        while (Offset > 0 && Name[Offset - 1] >= '0' && Name[Offset - 1] <= '9')
+        {
+            --Offset;
+        }
+
+        if (Offset == Name.size() || Name.size() - Offset > 2)
+        {
+            return -1;
+        }
+
+        SInt32 Register = 0;
+
+        for (; Offset < Name.size(); ++Offset)
+        {
+            Register = Register * 10 + (Name[Offset] - '0');
+        }
+        return Register;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
     Bool GLES3Driver::Initialize(Ptr<SDL_Window> Swapchain, UInt16 Width, UInt16 Height, UInt8 Samples)
     {
         mDevice  = Swapchain;
@@ -309,6 +375,14 @@ namespace Graphic
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+    void GLES3Driver::SetPipelineCache(Any<PipelineCache> Cache)
+    {
+        mPipelineCache = Move(Cache);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
     void GLES3Driver::CreateBuffer(Object ID, Usage Type, Bool Immutable, ConstPtr<UInt8> Data, UInt32 Length)
     {
         Ref<GLES3Buffer> Buffer = mBuffers[ID];
@@ -373,33 +447,51 @@ namespace Graphic
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-    void GLES3Driver::CreatePipeline(Object ID, CPtr<const UInt8> Vertex, CPtr<const UInt8> Pixel, CPtr<const UInt8> Geometry, ConstRef<Descriptor> Properties)
+    void GLES3Driver::CreatePipeline(Object ID, CPtr<const UInt8> Vertex, CPtr<const UInt8> Pixel, CPtr<const UInt8> Geometry, CPtr<const UInt8> Cache, ConstRef<Descriptor> Properties)
     {
         Ref<GLES3Pipeline> Pipeline  = mPipelines[ID];
 
-        // Compile all shader(s) into the Pipeline's program and link them.
         Pipeline.Program = glCreateProgram();
 
-        Compile(Pipeline.Program, GL_VERTEX_SHADER, Vertex);
-        Compile(Pipeline.Program, GL_FRAGMENT_SHADER, Pixel);
-
-        if (!Geometry.empty())
+        // Restore the program linked by a previous run when possible, which skips compiling its shader(s).
+        if (!mProgramBinary || !LoadProgram(Pipeline.Program, Cache))
         {
-            Compile(Pipeline.Program, GL_GEOMETRY_SHADER, Geometry);
-        }
+            const Bool Persistent = mProgramBinary && mPipelineCache.Save;
 
-        glLinkProgram(Pipeline.Program);
+            // Compile all shader(s) into the Pipeline's program and link them.
+            Compile(Pipeline.Program, GL_VERTEX_SHADER, Vertex);
+            Compile(Pipeline.Program, GL_FRAGMENT_SHADER, Pixel);
 
-        // Check if we linked the program with all shader(s)
-        GLint Success;
-        glGetProgramiv(Pipeline.Program, GL_LINK_STATUS, AddressOf(Success));
-        if (!Success)
-        {
-            GLchar Error[512];
-            glGetProgramInfoLog(Pipeline.Program, sizeof(Error), nullptr, Error);
-            Log::Critical("GLES3Driver: Failed to link program {}", Error);
+            if (!Geometry.empty())
+            {
+                Compile(Pipeline.Program, GL_GEOMETRY_SHADER, Geometry);
+            }
+
+            if (Persistent)
+            {
+                glProgramParameteri(Pipeline.Program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+            }
+
+            glLinkProgram(Pipeline.Program);
+
+            // Check if we linked the program with all shader(s)
+            GLint Success;
+            glGetProgramiv(Pipeline.Program, GL_LINK_STATUS, AddressOf(Success));
+            if (!Success)
+            {
+                GLchar Error[512];
+                glGetProgramInfoLog(Pipeline.Program, sizeof(Error), nullptr, Error);
+                Log::Critical("GLES3Driver: Failed to link program {}", Error);
+            }
+            else if (Persistent)
+            {
+                SaveProgram(Pipeline.Program, GetPipelineKey(Vertex, Pixel, Geometry, mCapabilities.Identity));
+            }
         }
 
+        // Bindings are not part of the program (nor of its binary), hence they are assigned after every link.
+        LoadBindings(Pipeline.Program);
+
         // Pre-compile all state properties.
         Pipeline.Cull                = As(Properties.Cull);
         Pipeline.Fill                = Properties.Fill ? GL_FILL : GL_LINE;
@@ -453,20 +545,28 @@ namespace Graphic
         Ref<GLES3Texture> Texture = mTextures[ID];
         Texture.Format            = As<1>(Format);
         Texture.Type              = As<2>(Format);
+        Texture.Stride            = GetTexturePitch(Format, 1);
 
         ConstPtr<UInt8> Bytes = Data.data();
         const UInt32 Kind     = As<0>(Format);
-        const UInt32 Depth    = As<3>(Format);
 
         glGenTextures(1, AddressOf(Texture.ID));
         glBindTexture(GL_TEXTURE_2D, Texture.ID);
 
         for (UInt8 Index = 0; Index < Level; ++Index)
         {
-            // @TODO: Compressed format(s)
-            glTexImage2D(GL_TEXTURE_2D, Index, Kind, Width, Height, 0, Texture.Format, Texture.Type, Bytes);
+            const UInt32 Size = GetTextureSize(Format, Width, Height);
 
-            Bytes += (Width * Depth * Height);
+            if (IsCompressed(Format))
+            {
+                glCompressedTexImage2D(GL_TEXTURE_2D, Index, Kind, Width, Height, 0, Size, Bytes);
+            }
+            else
+            {
+                glTexImage2D(GL_TEXTURE_2D, Index, Kind, Width, Height, 0, Texture.Format, Texture.Type, Bytes);
+            }
+
+            Bytes += (Bytes ? Size : 0);
             Width  = Max(1, Width  >> 1);
             Height = Max(1, Height >> 1);
         }
@@ -475,6 +575,11 @@ namespace Graphic
         {
             glGenerateMipmap(GL_TEXTURE_2D);
         }
+        else
+        {
+            // Limit sampling to the levels provided, otherwise a partial chain leaves the texture incomplete.
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, Level - 1);
+        }
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -485,8 +590,26 @@ namespace Graphic
         ConstRef<GLES3Texture> Texture = mTextures[ID];
 
         glBindTexture(GL_TEXTURE_2D, Texture.ID);
-        glPixelStorei(GL_UNPACK_ROW_LENGTH, Pitch);
-        // @TODO: Compressed format(s)
+
+        // Compressed textures carry no pixel type, and are updated in whole blocks packed without padding.
+        if (Texture.Type == GL_NONE)
+        {
+            glCompressedTexSubImage2D(
+                GL_TEXTURE_2D,
+                Level,
+                Offset.GetLeft(),
+                Offset.GetTop(),
+                Offset.GetWidth(),
+                Offset.GetHeight(),
+                Texture.Format,
+                Data.size(),
+                Data.data());
+            return;
+        }
+
+        // The pitch is given in bytes while the row length is counted in texels, restore it afterwards so that other
+        // uploads read their rows tightly packed.
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, Pitch / Texture.Stride);
         glTexSubImage2D(
                 GL_TEXTURE_2D,
                 Level,
@@ -497,6 +620,7 @@ namespace Graphic
                 Texture.Format,
                 Texture.Type,
                 Data.data());
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -664,6 +788,56 @@ namespace Graphic
     void GLES3Driver::LoadCapabilities()
     {
         mCapabilities.Backend = Backend::GLES3;
+
+        // ETC2 is core in GLES 3.0, desktop drivers expose it through the ES3 compatibility extension.
+        mCapabilities.ETC2 = GLAD_GL_ES_VERSION_3_0;
+
+        Bool HasS3TC = false;
+        Bool HasBPTC = false;
+
+        GLint Extensions = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, AddressOf(Extensions));
+
+        for (GLint Index = 0; Index < Extensions; ++Index)
+        {
+            const CStr Extension(reinterpret_cast<ConstPtr<Char>>(glGetStringi(GL_EXTENSIONS, Index)));
+
+            if (Extension == "GL_EXT_texture_compression_s3tc")
+            {
+                HasS3TC = true;
+            }
+            else if (Extension == "GL_EXT_texture_compression_bptc" || Extension == "GL_ARB_texture_compression_bptc")
+            {
+                HasBPTC = true;
+            }
+            else if (Extension == "GL_ARB_ES3_compatibility")
+            {
+                mCapabilities.ETC2 = true;
+            }
+        }
+        mCapabilities.BC = HasS3TC && HasBPTC;
+
+        // Some drivers expose the program binary entry points while supporting no format at all.
+        GLint Formats = 0;
+
+        if (glGetProgramBinary && glProgramBinary && glProgramParameteri)
+        {
+            glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, AddressOf(Formats));
+        }
+        mProgramBinary = Formats > 0;
+
+        // Program binaries are only valid for the driver that produced them, identified by its vendor, renderer and
+        // version strings.
+        if (mProgramBinary)
+        {
+            const auto GetString = [](GLenum Name)
+            {
+                ConstPtr<GLubyte> String = glGetString(Name);
+                return CStr(String ? reinterpret_cast<ConstPtr<Char>>(String) : "");
+            };
+            mCapabilities.Identity = Format("{}|{}|{}", GetString(GL_VENDOR), GetString(GL_RENDERER), GetString(GL_VERSION));
+        }
+
         // @TODO Capabilities
     }
 
@@ -715,6 +889,97 @@ namespace Graphic
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+    Bool GLES3Driver::LoadProgram(UInt32 Program, CPtr<const UInt8> Entry)
+    {
+        UInt32 Format = 0;
+
+        if (const CPtr<const UInt8> Binary = DecodePipelineBinary(Entry, mCapabilities.Identity, Format); !Binary.empty())
+        {
+            glProgramBinary(Program, Format, Binary.data(), Binary.size());
+
+            // Drivers are free to reject any binary (even one they produced), in which case the program is linked
+            // from its source and the entry is replaced.
+            GLint Success;
+            glGetProgramiv(Program, GL_LINK_STATUS, AddressOf(Success));
+            return Success;
+        }
+        return false;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void GLES3Driver::SaveProgram(UInt32 Program, UInt64 Key)
+    {
+        GLint Length = 0;
+        glGetProgramiv(Program, GL_PROGRAM_BINARY_LENGTH, AddressOf(Length));
+
+        if (Length > 0)
+        {
+            Vector<UInt8> Binary(Length);
+
+            GLsizei Size   = 0;
+            GLenum  Format = 0;
+            glGetProgramBinary(Program, Length, AddressOf(Size), AddressOf(Format), Binary.data());
+
+            if (Size > 0)
+            {
+                const Data Entry = EncodePipelineBinary(mCapabilities.Identity, Format, CPtr<const UInt8>(Binary.data(), Size));
+                mPipelineCache.Save(Key, Entry.GetSpan<UInt8>());
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void GLES3Driver::LoadBindings(UInt32 Program)
+    {
+        GLchar Name[128];
+        GLint  Count = 0;
+
+        // GLSL ES 3.0 has no 'binding' layout qualifier, uniform blocks are bound to the register their name ends
+        // with instead (such as 'uniform Global0'), mirroring 'register(b0)' in HLSL.
+        glGetProgramiv(Program, GL_ACTIVE_UNIFORM_BLOCKS, AddressOf(Count));
+
+        for (GLint Index = 0; Index < Count; ++Index)
+        {
+            GLsizei Length = 0;
+            glGetActiveUniformBlockName(Program, Index, sizeof(Name), AddressOf(Length), Name);
+
+            if (const SInt32 Register = GetRegister(CStr(Name, Length)); Register >= 0 && Register < k_MaxUniforms)
+            {
+                glUniformBlockBinding(Program, Index, Register);
+            }
+        }
+
+        // Samplers follow the same convention (such as 'uniform sampler2D ColorTexture0'), but can only be assigned
+        // while their program is in use. The previous one is restored given that submissions track it.
+        GLint Previous = 0;
+        glGetIntegerv(GL_CURRENT_PROGRAM, AddressOf(Previous));
+        glUseProgram(Program);
+
+        glGetProgramiv(Program, GL_ACTIVE_UNIFORMS, AddressOf(Count));
+
+        for (GLint Index = 0; Index < Count; ++Index)
+        {
+            GLsizei Length = 0;
+            GLint   Size   = 0;
+            GLenum  Type   = 0;
+            glGetActiveUniform(Program, Index, sizeof(Name), AddressOf(Length), AddressOf(Size), AddressOf(Type), Name);
+
+            if (const SInt32 Register = GetRegister(CStr(Name, Length)); IsSampler(Type) && Register >= 0 && Register < k_MaxSlots)
+            {
+                glUniform1i(glGetUniformLocation(Program, Name), Register);
+            }
+        }
+
+        glUseProgram(Previous);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
     Ref<GLES3Driver::GLES3Sampler> GLES3Driver::GetOrCreateSampler(ConstRef<Sampler> Descriptor)
     {
         Ref<GLES3Sampler> Sampler = mSamplers[
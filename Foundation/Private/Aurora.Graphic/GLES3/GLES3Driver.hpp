@@ -35,6 +35,9 @@ namespace Graphic
         // \see Driver::GetCapabilities
         ConstRef<Capabilities> GetCapabilities() const override;
 
+        // \see Driver::SetPipelineCache
+        void SetPipelineCache(Any<PipelineCache> Cache) override;
+
         // \see Driver::CreateBuffer
         void CreateBuffer(Object ID, Usage Type, Bool Immutable, ConstPtr<UInt8> Data, UInt32 Length) override;
 
@@ -54,7 +57,7 @@ namespace Graphic
         void DeletePass(Object ID) override;
 
         // \see Driver::CreatePipeline
-        void CreatePipeline(Object ID, CPtr<const UInt8> Vertex, CPtr<const UInt8> Pixel, CPtr<const UInt8> Geometry, ConstRef<Descriptor> Properties) override;
+        void CreatePipeline(Object ID, CPtr<const UInt8> Vertex, CPtr<const UInt8> Pixel, CPtr<const UInt8> Geometry, CPtr<const UInt8> Cache, ConstRef<Descriptor> Properties) override;
 
         // \see Driver::DeletePipeline
         void DeletePipeline(Object ID) override;
@@ -241,6 +244,9 @@ namespace Graphic
             // -=(Undocumented)=-
             UInt32 Type;
 
+            // Size (in bytes) of a single texel, used to translate a pitch into the row length of an upload.
+            UInt32 Stride;
+
             // -=(Undocumented)=-
             GLES3Texture()
                 : ID { 0 }
@@ -269,6 +275,15 @@ namespace Graphic
         // -=(Undocumented)=-
         Bool Compile(UInt32 Program, UInt32 Type, CPtr<const UInt8> Shader);
 
+        // Links the program from the binary held by a cache entry, returns false when the entry is not usable.
+        Bool LoadProgram(UInt32 Program, CPtr<const UInt8> Entry);
+
+        // Stores the binary of a linked program under the given key.
+        void SaveProgram(UInt32 Program, UInt64 Key);
+
+        // Assigns the uniform block and sampler bindings of a linked program, by the register each name ends with.
+        void LoadBindings(UInt32 Program);
+
         // -=(Undocumented)=-
         Ref<GLES3Sampler> GetOrCreateSampler(ConstRef<Sampler> Descriptor);
 
@@ -291,6 +306,8 @@ namespace Graphic
         Capabilities    mCapabilities;
         Submission      mSubmission;
         Rectf           mViewport;
+        Bool            mProgramBinary;
+        PipelineCache   mPipelineCache;
 
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -13,12 +13,14 @@
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
 #include "Bit.hpp"
+#include "Checksum.hpp"
 
 #include "Container/Data.hpp"
 #include "Container/Handle.hpp"
 #include "Container/Pool.hpp"
 #include "Container/Sparse.hpp"
 
+#include "IO/Compression.hpp"
 #include "IO/Reader.hpp"
 #include "IO/Writer.hpp"
 #include "IO/Stream.hpp"
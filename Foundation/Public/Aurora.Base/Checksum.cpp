@@ -0,0 +1,289 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2025 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Checksum.hpp"
+#include <bit>
+
+#if   defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+
+    #include <nmmintrin.h>
+
+    #define AE_CHECKSUM_SSE42
+
+    #if   defined(__GNUC__) || defined(__clang__)
+        #define AE_CHECKSUM_TARGET __attribute__((target("sse4.2")))
+    #else
+        #define AE_CHECKSUM_TARGET
+    #endif
+
+#elif defined(__ARM_FEATURE_CRC32)
+
+    #include <arm_acle.h>
+
+    #define AE_CHECKSUM_ARMV8
+
+#endif
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+inline namespace Core
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    // Castagnoli polynomial (reversed), the same one implemented by the SSE4.2 and ARMv8 instructions.
+    static constexpr UInt32 k_CRC32CPolynomial = 0x82F63B78u;
+
+    // -=(Undocumented)=-
+    static constexpr UInt64 k_XXHashPrime1 = 0x9E3779B185EBCA87ull;
+
+    // -=(Undocumented)=-
+    static constexpr UInt64 k_XXHashPrime2 = 0xC2B2AE3D27D4EB4Full;
+
+    // -=(Undocumented)=-
+    static constexpr UInt64 k_XXHashPrime3 = 0x165667B19E3779F9ull;
+
+    // -=(Undocumented)=-
+    static constexpr UInt64 k_XXHashPrime4 = 0x85EBCA77C2B2AE63ull;
+
+    // -=(Undocumented)=-
+    static constexpr UInt64 k_XXHashPrime5 = 0x27D4EB2F165667C5ull;
+
+    // Slicing-by-8 lookup tables for the scalar implementation.
+    static constexpr auto k_CRC32CTable = []()
+    {
+        Array<Array<UInt32, 256>, 8> Table { };
+
+        for (UInt32 Index = 0; Index < 256; ++Index)
+        {
+            UInt32 Value = Index;
+
+            for (UInt32 Bit = 0; Bit < 8; ++Bit)
+            {
+                Value = (Value >> 1) ^ (k_CRC32CPolynomial & (0u - (Value & 1u)));
+            }
+            Table[0][Index] = Value;
+        }
+
+        for (UInt32 Index = 0; Index < 256; ++Index)
+        {
+            for (UInt32 Slice = 1; Slice < 8; ++Slice)
+            {
+                const UInt32 Previous = Table[Slice - 1][Index];
+                Table[Slice][Index] = (Previous >> 8) ^ Table[0][Previous & 0xFF];
+            }
+        }
+        return Table;
+    }();
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    template<typename Type>
+    static Type Load(ConstPtr<UInt8> Address)
+    {
+        Type Value;
+        std::memcpy(& Value, Address, sizeof(Type));
+
+        if constexpr (SDL_BYTEORDER == SDL_BIG_ENDIAN)
+        {
+            Value = std::byteswap(Value);
+        }
+        return Value;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static UInt32 CRC32CScalar(ConstPtr<UInt8> Address, UInt Length, UInt32 Value)
+    {
+        for (; Length >= 8; Length -= 8, Address += 8)
+        {
+            const UInt32 Lower = Load<UInt32>(Address) ^ Value;
+            const UInt32 Upper = Load<UInt32>(Address + 4);
+
+            Value = k_CRC32CTable[7][ Lower        & 0xFF] ^ k_CRC32CTable[6][(Lower >> 8)  & 0xFF]
+                  ^ k_CRC32CTable[5][(Lower >> 16) & 0xFF] ^ k_CRC32CTable[4][ Lower >> 24        ]
+                  ^ k_CRC32CTable[3][ Upper        & 0xFF] ^ k_CRC32CTable[2][(Upper >> 8)  & 0xFF]
+                  ^ k_CRC32CTable[1][(Upper >> 16) & 0xFF] ^ k_CRC32CTable[0][ Upper >> 24        ];
+        }
+
+        for (; Length > 0; --Length, ++Address)
+        {
+            Value = (Value >> 8) ^ k_CRC32CTable[0][(Value ^ (* Address)) & 0xFF];
+        }
+        return Value;
+    }
+
+#if   defined(AE_CHECKSUM_SSE42)
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    AE_CHECKSUM_TARGET static UInt32 CRC32CHardware(ConstPtr<UInt8> Address, UInt Length, UInt32 Value)
+    {
+    #if   defined(__x86_64__) || defined(_M_X64)
+
+        UInt64 Wide = Value;
+
+        for (; Length >= 8; Length -= 8, Address += 8)
+        {
+            Wide = _mm_crc32_u64(Wide, Load<UInt64>(Address));
+        }
+        Value = static_cast<UInt32>(Wide);
+
+    #endif
+
+        for (; Length >= 4; Length -= 4, Address += 4)
+        {
+            Value = _mm_crc32_u32(Value, Load<UInt32>(Address));
+        }
+
+        for (; Length > 0; --Length, ++Address)
+        {
+            Value = _mm_crc32_u8(Value, (* Address));
+        }
+        return Value;
+    }
+
+#elif defined(AE_CHECKSUM_ARMV8)
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static UInt32 CRC32CHardware(ConstPtr<UInt8> Address, UInt Length, UInt32 Value)
+    {
+        for (; Length >= 8; Length -= 8, Address += 8)
+        {
+            Value = __crc32cd(Value, Load<UInt64>(Address));
+        }
+
+        for (; Length > 0; --Length, ++Address)
+        {
+            Value = __crc32cb(Value, (* Address));
+        }
+        return Value;
+    }
+
+#endif
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt32 CRC32C(CPtr<const UInt8> Block, UInt32 Seed)
+    {
+        using Implementation = UInt32 (*)(ConstPtr<UInt8>, UInt, UInt32);
+
+#if   defined(AE_CHECKSUM_SSE42)
+
+        // SSE4.2 is not part of the x86-64 baseline, the instruction set is checked once at runtime.
+        static const Implementation Function = SDL_HasSSE42() ? CRC32CHardware : CRC32CScalar;
+
+#elif defined(AE_CHECKSUM_ARMV8)
+
+        static const Implementation Function = CRC32CHardware;
+
+#else
+
+        static const Implementation Function = CRC32CScalar;
+
+#endif
+
+        return ~Function(Block.data(), Block.size(), ~Seed);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static UInt64 XXHashRound(UInt64 Accumulator, UInt64 Lane)
+    {
+        Accumulator += Lane * k_XXHashPrime2;
+        Accumulator  = std::rotl(Accumulator, 31);
+        return Accumulator * k_XXHashPrime1;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static UInt64 XXHashMerge(UInt64 Accumulator, UInt64 Lane)
+    {
+        Accumulator ^= XXHashRound(0, Lane);
+        return Accumulator * k_XXHashPrime1 + k_XXHashPrime4;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt64 XXHash64(CPtr<const UInt8> Block, UInt64 Seed)
+    {
+        ConstPtr<UInt8> Address = Block.data();
+        UInt            Length  = Block.size();
+        UInt64          Result;
+
+        if (Length >= 32)
+        {
+            UInt64 Lane1 = Seed + k_XXHashPrime1 + k_XXHashPrime2;
+            UInt64 Lane2 = Seed + k_XXHashPrime2;
+            UInt64 Lane3 = Seed;
+            UInt64 Lane4 = Seed - k_XXHashPrime1;
+
+            for (; Length >= 32; Length -= 32, Address += 32)
+            {
+                Lane1 = XXHashRound(Lane1, Load<UInt64>(Address));
+                Lane2 = XXHashRound(Lane2, Load<UInt64>(Address + 8));
+                Lane3 = XXHashRound(Lane3, Load<UInt64>(Address + 16));
+                Lane4 = XXHashRound(Lane4, Load<UInt64>(Address + 24));
+            }
+
+            Result = std::rotl(Lane1, 1) + std::rotl(Lane2, 7) + std::rotl(Lane3, 12) + std::rotl(Lane4, 18);
+            Result = XXHashMerge(Result, Lane1);
+            Result = XXHashMerge(Result, Lane2);
+            Result = XXHashMerge(Result, Lane3);
+            Result = XXHashMerge(Result, Lane4);
+        }
+        else
+        {
+            Result = Seed + k_XXHashPrime5;
+        }
+
+        Result += Block.size();
+
+        for (; Length >= 8; Length -= 8, Address += 8)
+        {
+            Result ^= XXHashRound(0, Load<UInt64>(Address));
+            Result  = std::rotl(Result, 27) * k_XXHashPrime1 + k_XXHashPrime4;
+        }
+
+        if (Length >= 4)
+        {
+            Result ^= static_cast<UInt64>(Load<UInt32>(Address)) * k_XXHashPrime1;
+            Result  = std::rotl(Result, 23) * k_XXHashPrime2 + k_XXHashPrime3;
+            Length  -= 4;
+            Address += 4;
+        }
+
+        for (; Length > 0; --Length, ++Address)
+        {
+            Result ^= (* Address) * k_XXHashPrime5;
+            Result  = std::rotl(Result, 11) * k_XXHashPrime1;
+        }
+
+        Result ^= Result >> 33;
+        Result *= k_XXHashPrime2;
+        Result ^= Result >> 29;
+        Result *= k_XXHashPrime3;
+        Result ^= Result >> 32;
+        return Result;
+    }
+}
\ No newline at end of file
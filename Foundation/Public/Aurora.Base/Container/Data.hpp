@@ -154,6 +154,12 @@ inline namespace Core
             mSize = 0;
         }
 
+        // Shrinks the data to its leading bytes, the buffer is kept as it is.
+        void Truncate(UInt32 Size)
+        {
+            mSize = (Size < mSize ? Size : mSize);
+        }
+
         // -=(Undocumented)=-
         template<typename Type>
         void Copy(ConstPtr<Type> Source, UInt32 Length = sizeof(Type))
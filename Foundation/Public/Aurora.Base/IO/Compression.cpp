@@ -0,0 +1,452 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2025 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Compression.hpp"
+#include "Aurora.Base/Checksum.hpp"
+#include "Aurora.Base/Logger/Log.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Compression
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    // Minimum length of a match, shorter sequences are emitted as literals.
+    static constexpr UInt32 k_MinMatch     = 4;
+
+    // The last bytes of a block are always literals, so the decoder can copy in bulk without overrunning.
+    static constexpr UInt32 k_LastLiterals = 5;
+
+    // Matches must not start within the last bytes of a block.
+    static constexpr UInt32 k_MatchLimit   = 12;
+
+    // Maximum backward distance that can be encoded in a match offset.
+    static constexpr UInt32 k_MaxDistance  = 0xFFFF;
+
+    // Number of bits used to index the match finder's hash table.
+    static constexpr UInt32 k_HashLog      = 12;
+
+    // Largest input accepted by a frame, so that its bound still fits the 32-bit size fields.
+    static constexpr UInt32 k_MaxInput     = 0x7E000000;
+
+    // Magic number that identifies a frame ('AELZ').
+    static constexpr UInt32 k_FrameMagic   = 0x5A4C4541;
+
+    // Frame flag set when the payload is stored verbatim because it did not shrink.
+    static constexpr UInt32 k_FrameStored  = 0b00000001;
+
+    // Header written in front of every frame payload.
+    struct Frame
+    {
+        UInt32 Magic;
+        UInt32 Flags;
+        UInt32 Size;
+        UInt32 Length;
+        UInt32 Checksum;
+    };
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static UInt32 Load32(ConstPtr<UInt8> Address)
+    {
+        UInt32 Value;
+        std::memcpy(& Value, Address, sizeof(UInt32));
+        return Value;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static UInt32 Hash32(UInt32 Sequence)
+    {
+        return (Sequence * 2654435761u) >> (32u - k_HashLog);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Ptr<UInt8> WriteLength(Ptr<UInt8> Output, UInt32 Length)
+    {
+        for (; Length >= 255; Length -= 255)
+        {
+            (* Output++) = 255;
+        }
+        (* Output++) = static_cast<UInt8>(Length);
+        return Output;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Ptr<UInt8> WriteSequence(Ptr<UInt8> Output, ConstPtr<UInt8> Literals, UInt32 Count, UInt32 Offset, UInt32 Size)
+    {
+        Ptr<UInt8> Token = Output++;
+
+        if (Count >= 15)
+        {
+            (* Token) = 15 << 4;
+            Output    = WriteLength(Output, Count - 15);
+        }
+        else
+        {
+            (* Token) = static_cast<UInt8>(Count << 4);
+        }
+
+        if (Count > 0)
+        {
+            std::memcpy(Output, Literals, Count);
+            Output += Count;
+        }
+
+        if (Size > 0)
+        {
+            (* Output++) = static_cast<UInt8>(Offset);
+            (* Output++) = static_cast<UInt8>(Offset >> 8);
+
+            const UInt32 Extra = Size - k_MinMatch;
+
+            if (Extra >= 15)
+            {
+                (* Token) |= 15;
+                Output = WriteLength(Output, Extra - 15);
+            }
+            else
+            {
+                (* Token) |= static_cast<UInt8>(Extra);
+            }
+        }
+        return Output;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt32 GetBound(UInt32 Length)
+    {
+        return Length + (Length / 255) + 16;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt32 Encode(CPtr<const UInt8> Source, CPtr<UInt8> Destination)
+    {
+        if (Destination.size() < GetBound(Source.size()))
+        {
+            return 0;
+        }
+
+        const ConstPtr<UInt8> Base   = Source.data();
+        const UInt32          Length = Source.size();
+        Ptr<UInt8>            Output = Destination.data();
+        UInt32                Anchor = 0;
+
+        if (Length > k_MatchLimit)
+        {
+            Array<UInt32, 1u << k_HashLog> Table;
+            Table.fill(0);
+
+            const UInt32 Limit = Length - k_MatchLimit;
+            UInt32       Index = 1;
+
+            while (Index < Limit)
+            {
+                // Find the next candidate, skipping faster through data that does not compress.
+                const UInt32 Sequence = Load32(Base + Index);
+                const UInt32 Slot     = Hash32(Sequence);
+                const UInt32 Previous = Table[Slot];
+                Table[Slot] = Index;
+
+                if (Index - Previous > k_MaxDistance || Load32(Base + Previous) != Sequence)
+                {
+                    Index += 1 + ((Index - Anchor) >> 6);
+                    continue;
+                }
+
+                // Extend the match backward over the pending literals.
+                UInt32 Start     = Index;
+                UInt32 Reference = Previous;
+
+                while (Start > Anchor && Reference > 0 && Base[Start - 1] == Base[Reference - 1])
+                {
+                    --Start;
+                    --Reference;
+                }
+
+                // Extend the match forward, leaving enough literals at the end of the block.
+                const UInt32 End   = Length - k_LastLiterals;
+                UInt32       Match = Index + k_MinMatch;
+
+                while (Match < End && Base[Match] == Base[Reference + (Match - Start)])
+                {
+                    ++Match;
+                }
+
+                Output = WriteSequence(Output, Base + Anchor, Start - Anchor, Start - Reference, Match - Start);
+                Anchor = Match;
+
+                if (Match - 2 < Limit)
+                {
+                    Table[Hash32(Load32(Base + Match - 2))] = Match - 2;
+                }
+                Index = Match;
+            }
+        }
+
+        Output = WriteSequence(Output, Base + Anchor, Length - Anchor, 0, 0);
+
+        return static_cast<UInt32>(Output - Destination.data());
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt32 Decode(CPtr<const UInt8> Source, CPtr<UInt8> Destination)
+    {
+        ConstPtr<UInt8> Input      = Source.data();
+        ConstPtr<UInt8> InputEnd   = Input + Source.size();
+        Ptr<UInt8>      Output     = Destination.data();
+        Ptr<UInt8>      OutputEnd  = Output + Destination.size();
+
+        const auto ReadLength = [&](Ref<UInt32> Length)
+        {
+            UInt8 Byte;
+
+            do
+            {
+                if (Input >= InputEnd)
+                {
+                    return false;
+                }
+                Byte    = (* Input++);
+                Length += Byte;
+            }
+            while (Byte == 255);
+
+            return true;
+        };
+
+        while (Input < InputEnd)
+        {
+            const UInt8 Token = (* Input++);
+
+            // Copy the literals of the sequence.
+            UInt32 Count = (Token >> 4);
+
+            if (Count == 15 && !ReadLength(Count))
+            {
+                return 0;
+            }
+
+            if (Count > static_cast<UInt>(InputEnd - Input) || Count > static_cast<UInt>(OutputEnd - Output))
+            {
+                return 0;
+            }
+
+            if (Count > 0)
+            {
+                std::memcpy(Output, Input, Count);
+                Input  += Count;
+                Output += Count;
+            }
+
+            // The last sequence of a block has no match.
+            if (Input == InputEnd)
+            {
+                break;
+            }
+
+            if (InputEnd - Input < 2)
+            {
+                return 0;
+            }
+
+            const UInt32 Offset = Input[0] | (Input[1] << 8);
+            Input += 2;
+
+            if (Offset == 0 || Offset > static_cast<UInt>(Output - Destination.data()))
+            {
+                return 0;
+            }
+
+            // Copy the match, byte by byte when it overlaps the output.
+            UInt32 Match = (Token & 15);
+
+            if (Match == 15 && !ReadLength(Match))
+            {
+                return 0;
+            }
+            Match += k_MinMatch;
+
+            if (Match > static_cast<UInt>(OutputEnd - Output))
+            {
+                return 0;
+            }
+
+            ConstPtr<UInt8> Reference = Output - Offset;
+
+            if (Offset >= Match)
+            {
+                std::memcpy(Output, Reference, Match);
+                Output += Match;
+            }
+            else
+            {
+                for (UInt32 Element = 0; Element < Match; ++Element)
+                {
+                    (* Output++) = Reference[Element];
+                }
+            }
+        }
+        return static_cast<UInt32>(Output - Destination.data());
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static UInt32 Pack(CPtr<const UInt8> Input, Ptr<UInt8> Output)
+    {
+        Frame Header;
+        Header.Magic    = k_FrameMagic;
+        Header.Flags    = 0;
+        Header.Size     = Input.size();
+        Header.Checksum = CRC32C(Input);
+        Header.Length   = Encode(Input, CPtr<UInt8>(Output + sizeof(Frame), GetBound(Input.size())));
+
+        if (Header.Length == 0 || Header.Length >= Header.Size)
+        {
+            Header.Flags  = k_FrameStored;
+            Header.Length = Header.Size;
+
+            if (Header.Size > 0)
+            {
+                std::memcpy(Output + sizeof(Frame), Input.data(), Header.Size);
+            }
+        }
+
+        std::memcpy(Output, & Header, sizeof(Frame));
+
+        return sizeof(Frame) + Header.Length;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Compress(Ref<Writer> Output, CPtr<const UInt8> Input)
+    {
+        Data Block = Compress(Input);
+
+        if (Block.GetSize() == 0)
+        {
+            return;
+        }
+        Output.Write<ConstPtr<UInt8>>(Block.GetData<UInt8>(), Block.GetSize());
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Data Compress(CPtr<const UInt8> Input)
+    {
+        if (Input.size() > k_MaxInput)
+        {
+            Log::Warn("Compression: Input of {} bytes exceeds the frame limit of {} bytes", Input.size(), k_MaxInput);
+            return Data();
+        }
+
+        const Ptr<UInt8> Block = new UInt8[sizeof(Frame) + GetBound(Input.size())];
+        return Data(Block, Pack(Input, Block), Data::BASIC_DELETER<UInt8>);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Data Decompress(Ref<Reader> Input)
+    {
+        const ConstPtr<UInt8> Address = Input.Peek<ConstPtr<UInt8>>(sizeof(Frame));
+
+        if (Address == nullptr)
+        {
+            Log::Warn("Compression: Truncated frame header");
+            return Data();
+        }
+
+        Frame Header;
+        std::memcpy(& Header, Address, sizeof(Frame));
+
+        if (Header.Magic != k_FrameMagic)
+        {
+            Log::Warn("Compression: Invalid frame magic '{:#x}'", Header.Magic);
+            return Data();
+        }
+
+        if (Input.GetAvailable() < sizeof(Frame) + Header.Length)
+        {
+            Log::Warn("Compression: Truncated frame payload ({} of {} bytes)",
+                Input.GetAvailable() - sizeof(Frame), Header.Length);
+            return Data();
+        }
+
+        Input.Skip(sizeof(Frame));
+
+        const CPtr<const UInt8> Payload(Input.Read<ConstPtr<UInt8>>(Header.Length), Header.Length);
+
+        if (Header.Flags & k_FrameStored)
+        {
+            if (Header.Length != Header.Size)
+            {
+                Log::Warn("Compression: Stored frame size mismatch");
+                return Data();
+            }
+        }
+        else if (Header.Size > static_cast<UInt64>(Header.Length) * 255 + k_MinMatch)
+        {
+            Log::Warn("Compression: Frame size {} exceeds what {} payload bytes can decode to", Header.Size, Header.Length);
+            return Data();
+        }
+
+        Data Result(Header.Size);
+
+        if (Header.Flags & k_FrameStored)
+        {
+            if (Header.Size > 0)
+            {
+                Result.Copy(Payload.data(), Header.Size);
+            }
+        }
+        else if (Decode(Payload, Result.GetSpan<UInt8>()) != Header.Size)
+        {
+            Log::Warn("Compression: Corrupted frame payload");
+            return Data();
+        }
+
+        if (CRC32C(Result.GetSpan<UInt8>()) != Header.Checksum)
+        {
+            Log::Warn("Compression: Checksum mismatch");
+            return Data();
+        }
+        return Result;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Data Decompress(CPtr<const UInt8> Input)
+    {
+        Reader Archive(CPtr<UInt8>(const_cast<Ptr<UInt8>>(Input.data()), Input.size()));
+        return Decompress(Archive);
+    }
+}
\ No newline at end of file
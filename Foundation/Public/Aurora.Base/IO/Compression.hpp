@@ -0,0 +1,54 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2025 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Aurora.Base/Container/Data.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// A frame is a 20-byte header followed by its payload, all fields in host byte order:
+//
+//   UInt32 Magic      'AELZ'
+//   UInt32 Flags      bit 0 set when the payload is stored verbatim
+//   UInt32 Size       number of decoded bytes
+//   UInt32 Length     number of payload bytes that follow the header
+//   UInt32 Checksum   CRC32C of the decoded bytes
+//
+// Encode and Decode work on raw LZ4-style blocks without a header.
+namespace Compression
+{
+    // Returns the worst-case size that Encode may produce for Length input bytes.
+    UInt32 GetBound(UInt32 Length);
+
+    // Encodes a raw block into Destination, which must hold at least GetBound bytes.
+    // Returns the number of encoded bytes, or zero when the destination is too small.
+    UInt32 Encode(CPtr<const UInt8> Source, CPtr<UInt8> Destination);
+
+    // Decodes a raw block into Destination.
+    // Returns the number of decoded bytes, or zero when the block is malformed or does not fit the destination.
+    UInt32 Decode(CPtr<const UInt8> Source, CPtr<UInt8> Destination);
+
+    // Writes Input as a frame to Output, nothing is written when the input exceeds the frame limit.
+    void Compress(Ref<Writer> Output, CPtr<const UInt8> Input);
+
+    // Returns Input as a frame, or an empty block when the input exceeds the frame limit (just under 2 GiB).
+    Data Compress(CPtr<const UInt8> Input);
+
+    // Reads a frame from Input and returns its content, or an empty block when the frame is truncated or corrupted.
+    Data Decompress(Ref<Reader> Input);
+
+    // Returns the content of the frame in Input, or an empty block when the frame is truncated or corrupted.
+    Data Decompress(CPtr<const UInt8> Input);
+}
\ No newline at end of file
@@ -300,11 +300,11 @@ inline namespace Core
             }
             else if constexpr (std::is_same_v<Type, SStr> || std::is_same_v<Type, CStr>)
             {
-                return ReadString8();
+                return Type(ReadString8());
             }
             else if constexpr (std::is_same_v<Type, SStr16> || std::is_same_v<Type, CStr16>)
             {
-                return ReadString16();
+                return Type(ReadString16());
             }
             else
             {
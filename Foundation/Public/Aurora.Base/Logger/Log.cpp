@@ -11,7 +11,8 @@
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
 #include "Log.hpp"
-#include <spdlog/async.h>
+#include <mutex>
+#include <spdlog/details/os.h>
 
 #ifdef    SDL_PLATFORM_ANDROID
 
@@ -30,12 +31,475 @@
 
 namespace Log
 {
+    // Size in bytes of each thread's ring, a full ring makes the caller format and write synchronously.
+    static constexpr UInt32 k_RingCapacity = 64 * 1024;
+
+    // Alignment of every record within a ring.
+    static constexpr UInt32 k_RingAlignment = 16;
+
+    // Number of slots used to track callsites, callsites beyond it are not rate limited.
+    static constexpr UInt32 k_SiteCapacity = 4096;
+
+    // Number of slots probed before giving up on tracking a callsite.
+    static constexpr UInt32 k_SiteProbes = 16;
+
+    // Maximum number of messages accepted from the same callsite within a second.
+    static constexpr UInt32 k_SiteBudget = 64;
+
+    // -=(Undocumented)=-
+    struct alignas(k_RingAlignment) Record
+    {
+        // -=(Undocumented)=-
+        UInt32                        Size;
+
+        // -=(Undocumented)=-
+        UInt32                        Offset;
+
+        // -=(Undocumented)=-
+        spdlog::level::level_enum     Level;
+
+        // -=(Undocumented)=-
+        Formatter                     Function;
+
+        // -=(Undocumented)=-
+        CStr                          Format;
+
+        // -=(Undocumented)=-
+        spdlog::log_clock::time_point Time;
+    };
+
+    // -=(Undocumented)=-
+    struct Site
+    {
+        // File of the callsite that owns the slot, published once its line and column are set.
+        Atomic<ConstPtr<Char>> File    = nullptr;
+
+        // -=(Undocumented)=-
+        UInt32                 Line    = 0;
+
+        // -=(Undocumented)=-
+        UInt32                 Column  = 0;
+
+        // -=(Undocumented)=-
+        Atomic<UInt64>         Window  = 0;
+
+        // -=(Undocumented)=-
+        Atomic<UInt32>         Count   = 0;
+
+        // -=(Undocumented)=-
+        Atomic<UInt32>         Dropped = 0;
+    };
+
+    // -=(Undocumented)=-
+    class Ring final
+    {
+    public:
+
+        // -=(Undocumented)=-
+        Ring()
+            : mBuffer { NewUniquePtr<UInt8[]>(k_RingCapacity) },
+              mThread { spdlog::details::os::thread_id() },
+              mHead   { 0 },
+              mTail   { 0 },
+              mCommit { 0 },
+              mClosed { false }
+        {
+        }
+
+        // -=(Undocumented)=-
+        UInt GetThread() const
+        {
+            return mThread;
+        }
+
+        // -=(Undocumented)=-
+        Bool IsClosed() const
+        {
+            return mClosed.load(std::memory_order_acquire);
+        }
+
+        // -=(Undocumented)=-
+        Bool IsEmpty() const
+        {
+            return mHead.load(std::memory_order_acquire) == mTail.load(std::memory_order_acquire);
+        }
+
+        // -=(Undocumented)=-
+        void Close()
+        {
+            mClosed.store(true, std::memory_order_release);
+        }
+
+        // -=(Undocumented)=-
+        Ptr<Record> Reserve(UInt32 Size)
+        {
+            const UInt32 Head       = mHead.load(std::memory_order_relaxed);
+            const UInt32 Tail       = mTail.load(std::memory_order_acquire);
+            const UInt32 Offset     = Head % k_RingCapacity;
+            const UInt32 Contiguous = k_RingCapacity - Offset;
+            const UInt32 Padding    = (Size > Contiguous ? Contiguous : 0);
+
+            if (k_RingCapacity - (Head - Tail) < Padding + Size)
+            {
+                return nullptr;
+            }
+
+            // Records never wrap around, the tail of the buffer is skipped instead.
+            if (Padding >= sizeof(Record))
+            {
+                Ptr<Record> Filler = reinterpret_cast<Ptr<Record>>(mBuffer.get() + Offset);
+                Filler->Size     = Padding;
+                Filler->Function = nullptr;
+            }
+
+            mCommit = Head + Padding + Size;
+            return reinterpret_cast<Ptr<Record>>(mBuffer.get() + (Padding ? 0 : Offset));
+        }
+
+        // -=(Undocumented)=-
+        void Commit()
+        {
+            mHead.store(mCommit, std::memory_order_release);
+        }
+
+        // -=(Undocumented)=-
+        template<typename Function>
+        UInt32 Drain(Any<Function> Callback)
+        {
+            const UInt32 Head  = mHead.load(std::memory_order_acquire);
+            UInt32       Tail  = mTail.load(std::memory_order_relaxed);
+            UInt32       Count = 0;
+
+            while (Tail != Head)
+            {
+                const UInt32 Offset     = Tail % k_RingCapacity;
+                const UInt32 Contiguous = k_RingCapacity - Offset;
+
+                if (Contiguous < sizeof(Record))
+                {
+                    Tail += Contiguous;
+                    continue;
+                }
+
+                const Ptr<Record> Entry = reinterpret_cast<Ptr<Record>>(mBuffer.get() + Offset);
+
+                if (Entry->Function)
+                {
+                    Callback(* Entry, mBuffer.get() + Offset + Entry->Offset);
+                    ++Count;
+                }
+                Tail += Entry->Size;
+            }
+
+            mTail.store(Tail, std::memory_order_release);
+            return Count;
+        }
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        UPtr<UInt8[]>  mBuffer;
+        UInt           mThread;
+        Atomic<UInt32> mHead;
+        Atomic<UInt32> mTail;
+        UInt32         mCommit;
+        Atomic<Bool>   mClosed;
+    };
+
+    // -=(Undocumented)=-
+    struct Backend
+    {
+        // -=(Undocumented)=-
+        std::mutex           Mutex;
+
+        // Serializes the consumers of the rings, which are the backend thread and any synchronous writer.
+        std::mutex           Drain;
+
+        // -=(Undocumented)=-
+        Vector<SPtr<Ring>>   Rings;
+
+        // -=(Undocumented)=-
+        SPtr<spdlog::logger> Logger;
+
+        // -=(Undocumented)=-
+        Atomic<Bool>         Running = false;
+
+        // -=(Undocumented)=-
+        Atomic_Flag          Signal;
+
+        // -=(Undocumented)=-
+        Thread               Worker;
+
+        // -=(Undocumented)=-
+        Array<Site, k_SiteCapacity> Sites;
+    };
+
+    // -=(Undocumented)=-
+    struct Binding
+    {
+        // -=(Undocumented)=-
+        ~Binding()
+        {
+            if (Channel)
+            {
+                Channel->Close();
+            }
+        }
+
+        // -=(Undocumented)=-
+        SPtr<Ring> Channel;
+    };
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Backend              s_Backend;
+    static thread_local Binding s_Binding;
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static void Emit(spdlog::level::level_enum Level, spdlog::log_clock::time_point Time, UInt Thread, CStr Text)
+    {
+        spdlog::details::log_msg Message(Time, spdlog::source_loc { }, s_Backend.Logger->name(), Level, Text);
+        Message.thread_id = Thread;
+
+        for (ConstRef<spdlog::sink_ptr> Sink : s_Backend.Logger->sinks())
+        {
+            if (Sink->should_log(Message.level))
+            {
+                Sink->log(Message);
+
+                if (Message.level >= s_Backend.Logger->flush_level())
+                {
+                    Sink->flush();
+                }
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static UInt32 Flush(Ref<SStr> Buffer)
+    {
+        Vector<SPtr<Ring>> Rings;
+        {
+            std::lock_guard Guard(s_Backend.Mutex);
+            Rings = s_Backend.Rings;
+        }
+
+        UInt32 Count = 0;
+
+        for (ConstSPtr<Ring> Channel : Rings)
+        {
+            // The ring is checked as closed before draining, so nothing can be published to it afterwards.
+            const Bool Closed = Channel->IsClosed();
+
+            Count += Channel->Drain([&](ConstRef<Record> Entry, Ptr<void> Arguments)
+            {
+                Buffer.clear();
+                Entry.Function(Entry.Format, Arguments, & Buffer);
+
+                Emit(Entry.Level, Entry.Time, Channel->GetThread(), Buffer);
+            });
+
+            if (Closed && Channel->IsEmpty())
+            {
+                std::lock_guard Guard(s_Backend.Mutex);
+                std::erase(s_Backend.Rings, Channel);
+            }
+        }
+
+        return Count;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static void OnConsume(std::stop_token Token)
+    {
+        SStr Buffer;
+
+        while (! Token.stop_requested())
+        {
+            s_Backend.Signal.wait(false, std::memory_order_acquire);
+            s_Backend.Signal.clear(std::memory_order_release);
+
+            std::lock_guard Guard(s_Backend.Drain);
+            Flush(Buffer);
+        }
+
+        // Drain whatever was published while stopping.
+        std::lock_guard Guard(s_Backend.Drain);
+        while (Flush(Buffer) > 0);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Ptr<Site> Locate(ConstRef<std::source_location> Location)
+    {
+        const ConstPtr<Char> File = Location.file_name();
+        const UInt64         Key  = ((reinterpret_cast<UInt>(File) ^ (static_cast<UInt64>(Location.line()) << 20)
+                                  ^ Location.column()) * 0x9E3779B97F4A7C15ull) >> 32;
+
+        // Open addressing, every slot remembers its callsite so that callsites hashing to it are told apart.
+        for (UInt32 Probe = 0; Probe < k_SiteProbes; ++Probe)
+        {
+            Ref<Site>      Slot  = s_Backend.Sites[(Key + Probe) % k_SiteCapacity];
+            ConstPtr<Char> Owner = Slot.File.load(std::memory_order_acquire);
+
+            if (! Owner)
+            {
+                std::lock_guard Guard(s_Backend.Mutex);
+
+                if (Owner = Slot.File.load(std::memory_order_relaxed); ! Owner)
+                {
+                    Slot.Line   = Location.line();
+                    Slot.Column = Location.column();
+                    Slot.File.store(File, std::memory_order_release);
+                    return & Slot;
+                }
+            }
+
+            if (Owner == File && Slot.Line == Location.line() && Slot.Column == Location.column())
+            {
+                return & Slot;
+            }
+        }
+        return nullptr;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool Filter(spdlog::level::level_enum Level, ConstRef<std::source_location> Location, CStr Format,
+        spdlog::log_clock::time_point Time)
+    {
+        if (Level >= spdlog::level::critical)
+        {
+            return true;
+        }
+
+        // Limit how many messages each callsite can emit per second, so a single line spinning in an error path
+        // cannot flood the backend; callsites that find no free slot are let through.
+        const Ptr<Site> Slot = Locate(Location);
+
+        if (! Slot)
+        {
+            return true;
+        }
+
+        const UInt64 Window = std::chrono::duration_cast<std::chrono::seconds>(Time.time_since_epoch()).count();
+
+        if (UInt64 Previous = Slot->Window.load(std::memory_order_relaxed); Previous != Window)
+        {
+            if (Slot->Window.compare_exchange_strong(Previous, Window, std::memory_order_relaxed))
+            {
+                Slot->Count.store(0, std::memory_order_relaxed);
+
+                if (const UInt32 Dropped = Slot->Dropped.exchange(0, std::memory_order_relaxed); Dropped > 0)
+                {
+                    Warn("Log: Suppressed {} message(s) similar to '{}'", Dropped, Format);
+                }
+            }
+        }
+
+        if (Slot->Count.fetch_add(1, std::memory_order_relaxed) < k_SiteBudget)
+        {
+            return true;
+        }
+
+        Slot->Dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Ptr<void> Acquire(spdlog::level::level_enum Level, spdlog::log_clock::time_point Time, CStr Format,
+        Formatter Function, UInt32 Size, UInt32 Alignment)
+    {
+        if (! s_Backend.Running.load(std::memory_order_acquire) || Alignment > k_RingAlignment)
+        {
+            return nullptr;
+        }
+
+        if (! s_Binding.Channel)
+        {
+            s_Binding.Channel = NewPtr<Ring>();
+
+            std::lock_guard Guard(s_Backend.Mutex);
+            s_Backend.Rings.emplace_back(s_Binding.Channel);
+        }
+
+        const UInt32 Offset = Align(static_cast<UInt32>(sizeof(Record)), Alignment);
+        const UInt32 Length = Align(Offset + Size, k_RingAlignment);
+
+        if (Length > k_RingCapacity / 4)
+        {
+            return nullptr;
+        }
+
+        const Ptr<Record> Entry = s_Binding.Channel->Reserve(Length);
+
+        if (Entry)
+        {
+            Entry->Size     = Length;
+            Entry->Offset   = Offset;
+            Entry->Level    = Level;
+            Entry->Function = Function;
+            Entry->Format   = Format;
+            Entry->Time     = Time;
+
+            return reinterpret_cast<Ptr<UInt8>>(Entry) + Offset;
+        }
+        return nullptr;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Commit()
+    {
+        s_Binding.Channel->Commit();
+
+        if (! s_Backend.Signal.test_and_set(std::memory_order_acq_rel))
+        {
+            s_Backend.Signal.notify_one();
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Write(spdlog::level::level_enum Level, spdlog::log_clock::time_point Time, CStr Message)
+    {
+        std::lock_guard Guard(s_Backend.Drain);
+
+        if (s_Backend.Running.load(std::memory_order_acquire))
+        {
+            // Write out what every thread has published so far, so the message does not overtake them.
+            SStr Buffer;
+            Flush(Buffer);
+
+            Emit(Level, Time, spdlog::details::os::thread_id(), Message);
+        }
+        else
+        {
+            spdlog::default_logger_raw()->log(Time, spdlog::source_loc { }, Level, Message);
+        }
+    }
+
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
     void Initialize(CStr Filename)
     {
-        if (spdlog::thread_pool())
+        if (s_Backend.Running.load(std::memory_order_acquire))
         {
             return;
         }
@@ -61,19 +525,21 @@ namespace Log
 
 #endif // SDL_PLATFORM_ANDROID
 
-        // Create the backend logging thread
-        spdlog::init_thread_pool(8192, 1);
-        spdlog::flush_every(std::chrono::seconds(3));
-
-        // Create the logger
-        SPtr<spdlog::logger> Logger
-            = NewPtr<spdlog::async_logger>("Aurora", Sinks.begin(), Sinks.end(), spdlog::thread_pool());
+        // Create the logger, sinks are only written while holding the drain lock
+        SPtr<spdlog::logger> Logger = NewPtr<spdlog::logger>("Aurora", Sinks.begin(), Sinks.end());
         spdlog::register_logger(Logger);
         spdlog::set_default_logger(Logger);
+        spdlog::flush_every(std::chrono::seconds(3));
 
         // Configure the pattern of all handlers
         Logger->set_pattern("%D %H:%M:%S.%e [%t] - %L - %v");
         Logger->set_level(spdlog::level::debug);
+        Logger->flush_on(spdlog::level::err);
+
+        // Create the backend logging thread
+        s_Backend.Logger = Logger;
+        s_Backend.Running.store(true, std::memory_order_release);
+        s_Backend.Worker = Thread(OnConsume);
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -81,6 +547,13 @@ namespace Log
 
     void Shutdown()
     {
+        if (s_Backend.Running.exchange(false, std::memory_order_acq_rel))
+        {
+            s_Backend.Worker.request_stop();
+            s_Backend.Signal.test_and_set(std::memory_order_release);
+            s_Backend.Signal.notify_one();
+            s_Backend.Worker.join();
+        }
         spdlog::shutdown();
     }
 
@@ -14,6 +14,8 @@
 
 #include "Level.hpp"
 #include <spdlog/spdlog.h>
+#include <source_location>
+#include <tuple>
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 // [   CODE   ]
@@ -21,6 +23,36 @@
 
 namespace Log
 {
+    // -=(Undocumented)=-
+    using Formatter = void (*)(CStr Format, Ptr<void> Arguments, Ptr<SStr> Output);
+
+    // Arguments are captured by value, so views into caller owned memory are promoted to owning strings.
+    template<typename Type>
+    using Capture = std::conditional_t<std::is_convertible_v<std::decay_t<Type>, CStr>, SStr, std::decay_t<Type>>;
+
+    // Format string of a log call together with the location of the call, which identifies it for rate limiting.
+    template<typename... Args>
+    struct Callsite
+    {
+        // -=(Undocumented)=-
+        template<typename Type>
+        consteval Callsite(ConstRef<Type> Text, std::source_location Location = std::source_location::current())
+            : Format   { Text },
+              Location { Location }
+        {
+        }
+
+        // -=(Undocumented)=-
+        spdlog::format_string_t<Args...> Format;
+
+        // -=(Undocumented)=-
+        std::source_location             Location;
+    };
+
+    // Prevents the callsite from taking part in the deduction of the arguments.
+    template<typename... Args>
+    using Callsite_t = Callsite<std::type_identity_t<Args>...>;
+
     // -=(Undocumented)=-
     void Initialize(CStr Filename);
 
@@ -29,46 +61,110 @@ namespace Log
 
     // -=(Undocumented)=-
     void SetLevel(Level Level);
-    
+
+    // -=(Undocumented)=-
+    Bool Filter(spdlog::level::level_enum Level, ConstRef<std::source_location> Location, CStr Format,
+        spdlog::log_clock::time_point Time);
+
+    // -=(Undocumented)=-
+    Ptr<void> Acquire(spdlog::level::level_enum Level, spdlog::log_clock::time_point Time, CStr Format,
+        Formatter Function, UInt32 Size, UInt32 Alignment);
+
+    // -=(Undocumented)=-
+    void Commit();
+
+    // Writes an already formatted message synchronously, after every message still pending on the backend.
+    void Write(spdlog::level::level_enum Level, spdlog::log_clock::time_point Time, CStr Message);
+
+    // -=(Undocumented)=-
+    template<typename... Args>
+    void Render(CStr Format, Ptr<void> Arguments, Ptr<SStr> Output)
+    {
+        using Tuple = std::tuple<Capture<Args>...>;
+
+        const Ptr<Tuple> Values = static_cast<Ptr<Tuple>>(Arguments);
+
+        if (Output)
+        {
+            std::apply([&](Ref<Capture<Args>> ... Value)
+            {
+                std::vformat_to(std::back_inserter(* Output), Format, std::make_format_args(Value...));
+            }, * Values);
+        }
+        Values->~Tuple();
+    }
+
+    // -=(Undocumented)=-
+    template<typename... Args>
+    void Submit(spdlog::level::level_enum Level, ConstRef<Callsite_t<Args...>> Site, Any<Args> ... Arguments)
+    {
+        using Tuple = std::tuple<Capture<Args>...>;
+
+        if (! spdlog::should_log(Level))
+        {
+            return;
+        }
+
+        // The clock is read once, it stamps the message and selects the rate limiting window.
+        const spdlog::log_clock::time_point Time = spdlog::log_clock::now();
+        const CStr                          Text = Site.Format.get();
+
+        if (! Filter(Level, Site.Location, Text, Time))
+        {
+            return;
+        }
+
+        // Capture the arguments into the thread's ring, formatting happens later on the backend thread.
+        if (const Ptr<void> Address = Acquire(Level, Time, Text, & Render<Args...>, sizeof(Tuple), alignof(Tuple)))
+        {
+            new (Address) Tuple(std::forward<Args>(Arguments)...);
+            Commit();
+        }
+        else
+        {
+            Write(Level, Time, spdlog::fmt_lib::format(Site.Format, std::forward<Args>(Arguments)...));
+        }
+    }
+
     // -=(Undocumented)=-
     template <typename... Args>
-    void Trace(spdlog::format_string_t<Args...> Format, Any<Args> ... Arguments)
+    void Trace(Callsite_t<Args...> Site, Any<Args> ... Arguments)
     {
-        spdlog::log(spdlog::level::trace, Format, std::forward<Args>(Arguments)...);
+        Submit<Args...>(spdlog::level::trace, Site, std::forward<Args>(Arguments)...);
     }
 
     // -=(Undocumented)=-
     template <typename... Args>
-    void Debug(spdlog::format_string_t<Args...> Format, Any<Args> ...Arguments)
+    void Debug(Callsite_t<Args...> Site, Any<Args> ...Arguments)
     {
-        spdlog::log(spdlog::level::debug, Format, std::forward<Args>(Arguments)...);
+        Submit<Args...>(spdlog::level::debug, Site, std::forward<Args>(Arguments)...);
     }
 
     // -=(Undocumented)=-
     template <typename... Args>
-    void Info(spdlog::format_string_t<Args...> Format, Any<Args> ...Arguments)
+    void Info(Callsite_t<Args...> Site, Any<Args> ...Arguments)
     {
-        spdlog::log(spdlog::level::info, Format, std::forward<Args>(Arguments)...);
+        Submit<Args...>(spdlog::level::info, Site, std::forward<Args>(Arguments)...);
     }
 
     // -=(Undocumented)=-
     template <typename... Args>
-    void Warn(spdlog::format_string_t<Args...> Format, Args &&...Arguments)
+    void Warn(Callsite_t<Args...> Site, Args &&...Arguments)
     {
-        spdlog::log(spdlog::level::warn, Format, std::forward<Args>(Arguments)...);
+        Submit<Args...>(spdlog::level::warn, Site, std::forward<Args>(Arguments)...);
     }
 
     // -=(Undocumented)=-
     template <typename... Args>
-    void Error(spdlog::format_string_t<Args...> Format, Any<Args> ...Arguments)
+    void Error(Callsite_t<Args...> Site, Any<Args> ...Arguments)
     {
-        spdlog::log(spdlog::level::err, Format, std::forward<Args>(Arguments)...);
+        Submit<Args...>(spdlog::level::err, Site, std::forward<Args>(Arguments)...);
     }
 
     // -=(Undocumented)=-
     template <typename... Args>
-    void Critical(spdlog::format_string_t<Args...> Format, Any<Args> ...Arguments)
+    void Critical(Callsite_t<Args...> Site, Any<Args> ...Arguments)
     {
-        spdlog::log(spdlog::level::critical, Format, std::forward<Args>(Arguments)...);
+        Submit<Args...>(spdlog::level::critical, Site, std::forward<Args>(Arguments)...);
     }
 }
\ No newline at end of file
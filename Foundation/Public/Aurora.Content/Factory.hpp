@@ -13,6 +13,7 @@
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
 #include "Uri.hpp"
+#include <shared_mutex>
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 // [   CODE   ]
@@ -21,17 +22,18 @@
 namespace Content
 {
     // -=(Undocumented)=-
-    template<typename Type>
-    class Factory final
+    class Resource;
+
+    // -=(Undocumented)=-
+    class FactoryBase
     {
     public:
 
         // -=(Undocumented)=-
-        Factory()
-            : mBudget { 0 },
-              mUsage  { 0 }
-        {
-        }
+        FactoryBase();
+
+        // -=(Undocumented)=-
+        virtual ~FactoryBase();
 
         // -=(Undocumented)=-
         void SetMemoryBudget(UInt Budget)
@@ -48,43 +50,127 @@ namespace Content
         // -=(Undocumented)=-
         void AddMemoryUsage(UInt Usage)
         {
-            mUsage += Usage;
+            mUsage.fetch_add(Usage, std::memory_order_relaxed);
+        }
+
+        // -=(Undocumented)=-
+        void SubMemoryUsage(UInt Usage)
+        {
+            mUsage.fetch_sub(Usage, std::memory_order_relaxed);
         }
 
         // -=(Undocumented)=-
         UInt GetMemoryUsage() const
         {
-            return mUsage;
+            return mUsage.load(std::memory_order_relaxed);
         }
 
         // -=(Undocumented)=-
-        SPtr<Type> GetOrCreate(ConstRef<Uri> Key, Bool CreateIfNeeded)
+        Bool IsOverBudget() const
+        {
+            return mBudget > 0 && GetMemoryUsage() > mBudget;
+        }
+
+        // Removes the least recently used assets that are no longer referenced outside the factory until
+        // the memory usage fits in the budget, returning them so they can be deleted by the caller.
+        virtual Vector<SPtr<Resource>> Evict() = 0;
+
+        // -=(Undocumented)=-
+        virtual SPtr<Resource> Find(AssetId Id) = 0;
+
+        // Gathers every asset loaded from the same file as the given id, whatever its fragment.
+        virtual void Find(AssetId Id, Ref<Vector<SPtr<Resource>>> Output) = 0;
+
+        // -=(Undocumented)=-
+        virtual void Collect(Ref<Vector<SPtr<Resource>>> Output) = 0;
+
+    public:
+
+        // -=(Undocumented)=-
+        static Vector<Ptr<FactoryBase>> GetFactories();
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        UInt         mBudget;
+        Atomic<UInt> mUsage;
+    };
+
+    // Registry of every asset of a given type.
+    //
+    // The registry is split in shards selected by the asset's id, each one guarded by its own reader/writer lock, so that
+    // lookups from several threads only contend when they touch the same shard. An asset is registered as soon as it is
+    // requested, with \see Resource::Status::None, and acts as the placeholder every concurrent request receives; the
+    // first request that claims it is the only one that loads it.
+    template<typename Type>
+    class Factory final : public FactoryBase
+    {
+    public:
+
+        // Number of shards the registry is split in, must be a power of two.
+        static constexpr UInt k_Shards = 16;
+
+    public:
+
+        // -=(Undocumented)=-
+        Factory()
+            : mClock { 0 }
         {
-            SPtr<Type> Result;
+        }
 
-            if (const auto Iterator = mRegistry.find(Key.GetPath()); Iterator != mRegistry.end())
+        // -=(Undocumented)=-
+        SPtr<Type> GetOrCreate(ConstRef<Uri> Key, Bool CreateIfNeeded)
+        {
+            Ref<Shard> Partition = GetShard(Key.GetId());
             {
-                Result = Iterator->second;
+                std::shared_lock Guard(Partition.Mutex);
+
+                if (const auto Iterator = Partition.Registry.find(Key.GetId()); Iterator != Partition.Registry.end())
+                {
+                    Touch(* Iterator->second);
+                    return Iterator->second;
+                }
             }
-            else if (CreateIfNeeded)
+
+            if (! CreateIfNeeded)
             {
-                Result = NewPtr<Type>(Move(Key));
+                return nullptr;
+            }
+
+            // Look it up again, another thread may have registered it while the lock was released.
+            std::unique_lock Guard(Partition.Mutex);
 
-                mRegistry.try_emplace(Result->GetKey().GetPath(), Result);
+            auto [Iterator, Inserted] = Partition.Registry.try_emplace(Key.GetId());
+
+            if (Inserted)
+            {
+                Iterator->second = NewPtr<Type>(Uri(Key));
+                Iterator->second->mOwner = this;
             }
-            return Result;
+            Touch(* Iterator->second);
+            return Iterator->second;
+        }
+
+        // -=(Undocumented)=-
+        SPtr<Type> GetOrNull(ConstRef<Uri> Key)
+        {
+            return GetOrCreate(Key, false);
         }
 
         // -=(Undocumented)=-
         Bool Remove(ConstRef<Uri> Key)
         {
-            if (const auto Iterator = mRegistry.find(Key.GetPath()); Iterator != mRegistry.end())
-            {
-                ConstSPtr<Type> Asset = Iterator->second;
+            Ref<Shard> Partition = GetShard(Key.GetId());
+
+            std::unique_lock Guard(Partition.Mutex);
 
-                if (Asset->HasFinished())
+            if (const auto Iterator = Partition.Registry.find(Key.GetId()); Iterator != Partition.Registry.end())
+            {
+                if (Iterator->second->HasFinished())
                 {
-                    mRegistry.erase(Iterator);
+                    Partition.Registry.erase(Iterator);
                     return true;
                 }
             }
@@ -96,31 +182,169 @@ namespace Content
         {
             Vector<SPtr<Type>> Collection;
 
-            for (auto Iterator = mRegistry.begin(); Iterator != mRegistry.end();)
+            for (Ref<Shard> Partition : mShards)
+            {
+                std::unique_lock Guard(Partition.Mutex);
+
+                for (auto Iterator = Partition.Registry.begin(); Iterator != Partition.Registry.end();)
+                {
+                    // Inspect the registry's own reference, a local copy would always add one to the count.
+                    ConstRef<SPtr<Type>> Asset = Iterator->second;
+
+                    if (Force || (Asset.use_count() == 1 && Asset->HasFinished()))
+                    {
+                        Collection.emplace_back(Asset);
+
+                        Iterator = Partition.Registry.erase(Iterator);
+                    }
+                    else
+                    {
+                        ++Iterator;
+                    }
+                }
+            }
+            return Collection;
+        }
+
+        // \see FactoryBase::Evict
+        Vector<SPtr<Resource>> Evict() override
+        {
+            Vector<SPtr<Resource>> Collection;
+
+            if (! IsOverBudget())
+            {
+                return Collection;
+            }
+
+            // Gather the assets only referenced by the registry, and release them from the least recently used one
+            // until the usage fits in the budget; each one is checked again since the shard was unlocked meanwhile.
+            Vector<Candidate> Candidates;
+
+            for (Ref<Shard> Partition : mShards)
             {
-                ConstSPtr<Type> Asset = Iterator->second;
+                std::shared_lock Guard(Partition.Mutex);
 
-                if (Force || (Asset.use_count() == 1 && Asset->HasFinished()))
+                for (const auto & [Id, Asset] : Partition.Registry)
                 {
-                    Collection.emplace_back(Asset);
+                    if (Asset.use_count() == 1 && Asset->HasFinished())
+                    {
+                        Candidates.emplace_back(Asset->mLastUse.load(std::memory_order_relaxed), Id);
+                    }
+                }
+            }
+
+            std::sort(Candidates.begin(), Candidates.end(), [](ConstRef<Candidate> Left, ConstRef<Candidate> Right)
+            {
+                return Left.Tick < Right.Tick;
+            });
+
+            UInt Usage = GetMemoryUsage();
 
-                    Iterator = mRegistry.erase(Iterator);
+            for (ConstRef<Candidate> Entry : Candidates)
+            {
+                if (Usage <= GetMemoryBudget())
+                {
+                    break;
                 }
-                else
+
+                Ref<Shard> Partition = GetShard(Entry.Id);
+
+                std::unique_lock Guard(Partition.Mutex);
+
+                if (const auto Iterator = Partition.Registry.find(Entry.Id); Iterator != Partition.Registry.end())
                 {
-                    ++Iterator;
+                    if (Iterator->second.use_count() == 1 && Iterator->second->HasFinished())
+                    {
+                        Usage -= std::min(Usage, Iterator->second->GetMemory());
+
+                        Collection.emplace_back(Move(Iterator->second));
+
+                        Partition.Registry.erase(Iterator);
+                    }
                 }
             }
             return Collection;
         }
 
+        // \see FactoryBase::Find
+        SPtr<Resource> Find(AssetId Id) override
+        {
+            Ref<Shard> Partition = GetShard(Id);
+
+            std::shared_lock Guard(Partition.Mutex);
+
+            const auto Iterator = Partition.Registry.find(Id);
+            return (Iterator != Partition.Registry.end() ? Iterator->second : nullptr);
+        }
+
+        // \see FactoryBase::Find
+        void Find(AssetId Id, Ref<Vector<SPtr<Resource>>> Output) override
+        {
+            // Shards are selected by the path alone, hence every asset of the file lives in the same one.
+            Ref<Shard> Partition = GetShard(Id);
+
+            std::shared_lock Guard(Partition.Mutex);
+
+            for (const auto & [Key, Asset] : Partition.Registry)
+            {
+                if (Key.IsSameFile(Id))
+                {
+                    Output.emplace_back(Asset);
+                }
+            }
+        }
+
+        // \see FactoryBase::Collect
+        void Collect(Ref<Vector<SPtr<Resource>>> Output) override
+        {
+            for (Ref<Shard> Partition : mShards)
+            {
+                std::shared_lock Guard(Partition.Mutex);
+
+                for (const auto & [_, Asset] : Partition.Registry)
+                {
+                    Output.emplace_back(Asset);
+                }
+            }
+        }
+
+    private:
+
+        // -=(Undocumented)=-
+        struct alignas(64) Shard
+        {
+            std::shared_mutex          Mutex;
+            Table<AssetId, SPtr<Type>> Registry;
+        };
+
+        // -=(Undocumented)=-
+        struct Candidate
+        {
+            UInt64  Tick;
+            AssetId Id;
+        };
+
+    private:
+
+        // -=(Undocumented)=-
+        Ref<Shard> GetShard(AssetId Id)
+        {
+            return mShards[Id.Hash & (k_Shards - 1)];
+        }
+
+        // Stamps the asset with the current tick, rather than moving it within a shared list, so that lookups
+        // only need to hold a shared lock.
+        void Touch(Ref<Type> Asset)
+        {
+            Asset.mLastUse.store(mClock.fetch_add(1, std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+
     private:
 
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-        StringTable<SPtr<Type>> mRegistry;
-        UInt                    mBudget;
-        UInt                    mUsage;
+        Array<Shard, k_Shards> mShards;
+        Atomic<UInt64>         mClock;
     };
 }
\ No newline at end of file
@@ -33,6 +33,9 @@ namespace Content
 
         // -=(Undocumented)=-
         virtual Bool Load(Ref<class Service> Service, Any<Data> File, Ref<Resource> Asset) = 0;
+
+        // Creates an empty resource of the type produced by this loader.
+        virtual SPtr<Resource> Allocate(ConstRef<Uri> Key) const = 0;
     };
 
     // -=(Undocumented)=-
@@ -46,5 +49,11 @@ namespace Content
         {
             return static_cast<Ptr<Impl>>(this)->OnLoad(Service, Move(File), reinterpret_cast<Ref<Type>>(Asset));
         }
+
+        // \see Loader::Allocate
+        SPtr<Resource> Allocate(ConstRef<Uri> Key) const override final
+        {
+            return NewPtr<Type>(Uri(Key));
+        }
     };
 }
\ No newline at end of file
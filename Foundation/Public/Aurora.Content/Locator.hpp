@@ -20,6 +20,65 @@
 
 namespace Content
 {
+    // Completion token of a write handed off to a locator.
+    class Ticket final
+    {
+    public:
+
+        // -=(Undocumented)=-
+        enum class State
+        {
+            Pending, Succeeded, Failed
+        };
+
+    public:
+
+        // -=(Undocumented)=-
+        Ticket()
+            : mState { State::Pending }
+        {
+        }
+
+        // -=(Undocumented)=-
+        void Complete(Bool Successful)
+        {
+            mState.store(Successful ? State::Succeeded : State::Failed, std::memory_order_release);
+            mState.notify_all();
+        }
+
+        // Blocks the calling thread until the write has finished, returning whether it succeeded.
+        Bool Wait() const
+        {
+            mState.wait(State::Pending, std::memory_order_acquire);
+            return HasSucceeded();
+        }
+
+        // -=(Undocumented)=-
+        State GetState() const
+        {
+            return mState.load(std::memory_order_acquire);
+        }
+
+        // -=(Undocumented)=-
+        Bool IsPending() const
+        {
+            return GetState() == State::Pending;
+        }
+
+        // -=(Undocumented)=-
+        Bool HasSucceeded() const
+        {
+            return GetState() == State::Succeeded;
+        }
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Atomic<State> mState;
+    };
+
     // -=(Undocumented)=-
     class Locator
     {
@@ -31,10 +90,41 @@ namespace Content
         // -=(Undocumented)=-
         virtual Data Read(CStr Path) = 0;
 
-        // -=(Undocumented)=-
-        virtual void Write(CStr Path, CPtr<const UInt8> Bytes) = 0;
+        // Writes the data synchronously, returning whether it was written.
+        virtual Bool Write(CStr Path, CPtr<const UInt8> Bytes) = 0;
 
-        // -=(Undocumented)=-
-        virtual void Delete(CStr Path) = 0;
+        // Deletes the path synchronously, returning whether it was deleted.
+        virtual Bool Delete(CStr Path) = 0;
+
+        // Hands the data off to the locator, which may write it in the background; the ticket completes once the
+        // data, or the data of a later write to the same path, has been written. Writes synchronously by default.
+        virtual SPtr<Ticket> Enqueue(CStr Path, Any<Data> Bytes)
+        {
+            const SPtr<Ticket> Token = NewPtr<Ticket>();
+            Token->Complete(Write(Path, Bytes.GetSpan<UInt8>()));
+            return Token;
+        }
+
+        // Blocks the calling thread until every write handed off so far has finished.
+        virtual void Flush()
+        {
+        }
+
+        // Returns whether the locator may hold the given path, without touching the filesystem whenever the
+        // locator keeps an index of its content; locators unable to tell must answer true.
+        virtual Bool Contains(CStr Path)
+        {
+            return true;
+        }
+
+        // Discards any index of the content, so that it is rebuilt on the next query.
+        virtual void Rescan()
+        {
+        }
+
+        // Appends the paths that have changed since the last call, for locators able to watch their content.
+        virtual void Poll(Ref<Vector<SStr>> Changes)
+        {
+        }
     };
 }
\ No newline at end of file
@@ -29,9 +29,12 @@ namespace Content
         Data Read(CStr Path) override;
 
         // \see Locator::Write(CStr, CPtr<const UInt8>)
-        void Write(CStr Path, CPtr<const UInt8> Bytes) override;
+        Bool Write(CStr Path, CPtr<const UInt8> Bytes) override;
 
         // \see Locator::Delete(CStr)
-        void Delete(CStr Path) override;
+        Bool Delete(CStr Path) override;
+
+        // \see Locator::Contains(CStr)
+        Bool Contains(CStr Path) override;
     };
 }
\ No newline at end of file
@@ -0,0 +1,225 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2025 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "PackBuilder.hpp"
+#include "Aurora.Base/IO/Compression.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Content
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    PackBuilder::PackBuilder(Bool Compress)
+        : mCompress { Compress }
+    {
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void PackBuilder::Add(CStr Path, CPtr<const UInt8> Bytes)
+    {
+        Ref<File> Item = mFiles.emplace_back();
+        Item.Path       = Path;
+        Item.Length     = Bytes.size();
+        Item.Compressed = false;
+
+        // Entries are only stored compressed when doing so saves at least an eighth of their size, otherwise
+        // the decompression cost outweighs the benefit of a smaller archive and the zero-copy path is lost.
+        if (mCompress && Bytes.size() > 0)
+        {
+            Item.Bytes.resize(Compression::GetBound(Bytes.size()));
+
+            const UInt32 Size = Compression::Encode(Bytes, Item.Bytes);
+
+            if (Size > 0 && Size < Bytes.size() - Bytes.size() / 8)
+            {
+                Item.Bytes.resize(Size);
+                Item.Compressed = true;
+                return;
+            }
+        }
+        Item.Bytes.assign(Bytes.begin(), Bytes.end());
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool PackBuilder::AddDirectory(CStr Directory)
+    {
+        SStr Root(Directory);
+
+        if (! Root.empty() && ! Root.ends_with('/') && ! Root.ends_with('\\'))
+        {
+            Root.push_back('/');
+        }
+        return AddDirectory(Root, "");
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Vector<UInt8> PackBuilder::Build() const
+    {
+        using Header = PackLocator::Header;
+        using Entry  = PackLocator::Entry;
+
+        // Sort the index by hash, so the locator can look up entries with a binary search.
+        Vector<Entry>  Entries(mFiles.size());
+        Vector<UInt32> Order(mFiles.size());
+
+        SStr Names;
+
+        for (UInt32 Index = 0; Index < mFiles.size(); ++Index)
+        {
+            ConstRef<File> Item = mFiles[Index];
+
+            Entries[Index].Hash       = PackLocator::Hash(Item.Path);
+            Entries[Index].Size       = Item.Bytes.size();
+            Entries[Index].Length     = Item.Length;
+            Entries[Index].Name       = Names.size();
+            Entries[Index].NameLength = Item.Path.size();
+            Entries[Index].Flags      = Item.Compressed ? PackLocator::k_Compressed : 0;
+
+            Names.append(Item.Path);
+            Order[Index] = Index;
+        }
+
+        std::sort(Order.begin(), Order.end(), [&](UInt32 Left, UInt32 Right)
+        {
+            return Entries[Left].Hash < Entries[Right].Hash;
+        });
+
+        // Lay out every payload after the index, each one aligned.
+        UInt64 Offset = Align(sizeof(Header) + Entries.size() * sizeof(Entry) + Names.size(), PackLocator::k_Alignment);
+
+        for (const UInt32 Index : Order)
+        {
+            Entries[Index].Offset = Offset;
+
+            Offset = Align(Offset + Entries[Index].Size, PackLocator::k_Alignment);
+        }
+
+        Vector<UInt8> Archive(Offset, 0);
+
+        Header Descriptor;
+        Descriptor.Magic   = PackLocator::k_Magic;
+        Descriptor.Version = PackLocator::k_Version;
+        Descriptor.Count   = Entries.size();
+        Descriptor.Names   = Names.size();
+        std::memcpy(Archive.data(), & Descriptor, sizeof(Header));
+
+        Ptr<UInt8> Index = Archive.data() + sizeof(Header);
+
+        for (const UInt32 Position : Order)
+        {
+            std::memcpy(Index, & Entries[Position], sizeof(Entry));
+            Index += sizeof(Entry);
+
+            if (ConstRef<File> Item = mFiles[Position]; ! Item.Bytes.empty())
+            {
+                std::memcpy(Archive.data() + Entries[Position].Offset, Item.Bytes.data(), Item.Bytes.size());
+            }
+        }
+
+        if (! Names.empty())
+        {
+            std::memcpy(Index, Names.data(), Names.size());
+        }
+        return Archive;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool PackBuilder::Save(CStr Filename) const
+    {
+        const Vector<UInt8> Archive = Build();
+
+        if (const Ptr<SDL_IOStream> Stream = SDL_IOFromFile(SStr(Filename).c_str(), "wb"); Stream)
+        {
+            const Bool Successful = SDL_WriteIO(Stream, Archive.data(), Archive.size()) == Archive.size();
+            SDL_CloseIO(Stream);
+
+            if (Successful)
+            {
+                return true;
+            }
+        }
+
+        Log::Warn("Resources: Failed to write pack '{}'", Filename);
+        return false;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool PackBuilder::AddDirectory(ConstRef<SStr> Root, ConstRef<SStr> Folder)
+    {
+        Vector<SStr> Children;
+
+        const auto OnEnumerate = [](Ptr<void> User, ConstPtr<Char> Directory, ConstPtr<Char> Name)
+        {
+            static_cast<Ptr<Vector<SStr>>>(User)->emplace_back(Name);
+            return SDL_ENUM_CONTINUE;
+        };
+
+        if (! SDL_EnumerateDirectory(Format("{}{}", Root, Folder).c_str(), OnEnumerate, & Children))
+        {
+            Log::Warn("Resources: Failed to enumerate '{}{}'", Root, Folder);
+            return false;
+        }
+
+        // Sort the children so that archives are reproducible across platforms and filesystems.
+        std::sort(Children.begin(), Children.end());
+
+        for (ConstRef<SStr> Child : Children)
+        {
+            const SStr Path     = Folder.empty() ? Child : Format("{}/{}", Folder, Child);
+            const SStr Filepath = Format("{}{}", Root, Path);
+
+            SDL_PathInfo Information;
+
+            if (! SDL_GetPathInfo(Filepath.c_str(), & Information))
+            {
+                continue;
+            }
+
+            if (Information.type == SDL_PATHTYPE_DIRECTORY)
+            {
+                if (! AddDirectory(Root, Path))
+                {
+                    return false;
+                }
+            }
+            else if (Information.type == SDL_PATHTYPE_FILE)
+            {
+                size_t    Size  = 0;
+                Ptr<void> Bytes = SDL_LoadFile(Filepath.c_str(), & Size);
+
+                if (! Bytes)
+                {
+                    Log::Warn("Resources: Failed to read '{}'", Filepath);
+                    return false;
+                }
+
+                Add(Path, CPtr<const UInt8>(static_cast<ConstPtr<UInt8>>(Bytes), Size));
+                SDL_free(Bytes);
+            }
+        }
+        return true;
+    }
+}
\ No newline at end of file
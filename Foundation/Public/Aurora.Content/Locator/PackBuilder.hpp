@@ -0,0 +1,71 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2025 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "PackLocator.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Content
+{
+    // Creates pack archives readable by \see PackLocator.
+    class PackBuilder final
+    {
+    public:
+
+        // -=(Undocumented)=-
+        explicit PackBuilder(Bool Compress = true);
+
+        // -=(Undocumented)=-
+        void Add(CStr Path, CPtr<const UInt8> Bytes);
+
+        // Adds every file found (recursively) inside the given directory, keyed by its path relative to it.
+        Bool AddDirectory(CStr Directory);
+
+        // -=(Undocumented)=-
+        UInt32 GetCount() const
+        {
+            return mFiles.size();
+        }
+
+        // -=(Undocumented)=-
+        Vector<UInt8> Build() const;
+
+        // -=(Undocumented)=-
+        Bool Save(CStr Filename) const;
+
+    private:
+
+        // -=(Undocumented)=-
+        struct File
+        {
+            SStr          Path;
+            Vector<UInt8> Bytes;
+            UInt32        Length;
+            Bool          Compressed;
+        };
+
+        // -=(Undocumented)=-
+        Bool AddDirectory(ConstRef<SStr> Root, ConstRef<SStr> Folder);
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        const Bool   mCompress;
+        Vector<File> mFiles;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,300 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2025 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "PackLocator.hpp"
+#include "Aurora.Base/Checksum.hpp"
+#include "Aurora.Base/IO/Compression.hpp"
+
+#ifdef    SDL_PLATFORM_WIN32
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif // SDL_PLATFORM_WIN32
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Content
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    PackLocator::PackLocator(CStr Filename)
+        : mFile    { nullptr },
+          mMapping { nullptr },
+          mBytes   { nullptr },
+          mSize    { 0 },
+          mHeader  { nullptr }
+    {
+        if (! Map(Filename))
+        {
+            Log::Warn("Resources: Failed to map pack '{}'", Filename);
+            return;
+        }
+
+        // Validate the header and the index up front, so lookups can trust them afterwards.
+        const UInt Index = sizeof(Header);
+
+        if (mSize < Index)
+        {
+            Log::Warn("Resources: Pack '{}' is truncated", Filename);
+            return;
+        }
+
+        const ConstPtr<Header> Descriptor = reinterpret_cast<ConstPtr<Header>>(mBytes);
+
+        if (Descriptor->Magic != k_Magic || Descriptor->Version != k_Version)
+        {
+            Log::Warn("Resources: Pack '{}' has an unknown format", Filename);
+            return;
+        }
+
+        const UInt Names = Index + static_cast<UInt>(Descriptor->Count) * sizeof(Entry);
+
+        if (mSize < Names + Descriptor->Names)
+        {
+            Log::Warn("Resources: Pack '{}' is truncated", Filename);
+            return;
+        }
+
+        mHeader  = Descriptor;
+        mEntries = CPtr<const Entry>(reinterpret_cast<ConstPtr<Entry>>(mBytes + Index), Descriptor->Count);
+        mNames   = CStr(reinterpret_cast<ConstPtr<Char>>(mBytes + Names), Descriptor->Names);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    PackLocator::~PackLocator()
+    {
+        Unmap();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Data PackLocator::Read(CStr Path)
+    {
+        const ConstPtr<Entry> Item = Find(Path);
+
+        if (! Item)
+        {
+            return Data();
+        }
+
+        if (Item->Offset > mSize || Item->Size > mSize - Item->Offset)
+        {
+            Log::Warn("Resources: Pack entry '{}' is out of bounds", Path);
+            return Data();
+        }
+
+        const CPtr<const UInt8> Payload(mBytes + Item->Offset, Item->Size);
+
+        if (Item->Flags & k_Compressed)
+        {
+            Data Result(Item->Length);
+
+            if (Compression::Decode(Payload, Result.GetSpan<UInt8>()) != Item->Length)
+            {
+                Log::Warn("Resources: Pack entry '{}' is corrupted", Path);
+                return Data();
+            }
+            return Result;
+        }
+
+        // Copy the payload out of the mapping, as it is read-only and goes away with the locator, while loaders
+        // may decode in place and keep the buffer around.
+        Data Result(Payload.size());
+        Result.Copy(Payload.data(), Payload.size());
+        return Result;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool PackLocator::Write(CStr Path, CPtr<const UInt8> Bytes)
+    {
+        Log::Warn("Resources: Pack entries are read-only, cannot write '{}'", Path);
+        return false;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool PackLocator::Delete(CStr Path)
+    {
+        Log::Warn("Resources: Pack entries are read-only, cannot delete '{}'", Path);
+        return false;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool PackLocator::Contains(CStr Path)
+    {
+        return Find(Path) != nullptr;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt64 PackLocator::Hash(CStr Path)
+    {
+        return XXHash64(CPtr<const UInt8>(reinterpret_cast<ConstPtr<UInt8>>(Path.data()), Path.size()));
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool PackLocator::Map(CStr Filename)
+    {
+        const SStr Filepath(Filename);
+
+#ifdef    SDL_PLATFORM_WIN32
+        const HANDLE File = ::CreateFileA(
+            Filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS, nullptr);
+
+        if (File == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER Size;
+
+        if (! ::GetFileSizeEx(File, & Size) || Size.QuadPart == 0)
+        {
+            ::CloseHandle(File);
+            return false;
+        }
+
+        const HANDLE Mapping = ::CreateFileMappingA(File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+        if (! Mapping)
+        {
+            ::CloseHandle(File);
+            return false;
+        }
+
+        const LPVOID View = ::MapViewOfFile(Mapping, FILE_MAP_READ, 0, 0, 0);
+
+        if (! View)
+        {
+            ::CloseHandle(Mapping);
+            ::CloseHandle(File);
+            return false;
+        }
+
+        mFile    = File;
+        mMapping = Mapping;
+        mBytes   = static_cast<ConstPtr<UInt8>>(View);
+        mSize    = static_cast<UInt>(Size.QuadPart);
+#else
+        const SInt32 File = ::open(Filepath.c_str(), O_RDONLY);
+
+        if (File < 0)
+        {
+            return false;
+        }
+
+        struct stat Status;
+
+        if (::fstat(File, & Status) != 0 || Status.st_size == 0)
+        {
+            ::close(File);
+            return false;
+        }
+
+        const Ptr<void> View = ::mmap(nullptr, Status.st_size, PROT_READ, MAP_PRIVATE, File, 0);
+
+        // The mapping keeps a reference to the file, so the descriptor is no longer needed.
+        ::close(File);
+
+        if (View == MAP_FAILED)
+        {
+            return false;
+        }
+
+        mMapping = View;
+        mBytes   = static_cast<ConstPtr<UInt8>>(View);
+        mSize    = static_cast<UInt>(Status.st_size);
+#endif // SDL_PLATFORM_WIN32
+
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void PackLocator::Unmap()
+    {
+#ifdef    SDL_PLATFORM_WIN32
+        if (mBytes)
+        {
+            ::UnmapViewOfFile(mBytes);
+        }
+
+        if (mMapping)
+        {
+            ::CloseHandle(mMapping);
+        }
+
+        if (mFile)
+        {
+            ::CloseHandle(mFile);
+        }
+#else
+        if (mMapping)
+        {
+            ::munmap(mMapping, mSize);
+        }
+#endif // SDL_PLATFORM_WIN32
+
+        mFile    = nullptr;
+        mMapping = nullptr;
+        mBytes   = nullptr;
+        mSize    = 0;
+        mHeader  = nullptr;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    ConstPtr<PackLocator::Entry> PackLocator::Find(CStr Path) const
+    {
+        if (! mHeader)
+        {
+            return nullptr;
+        }
+
+        const UInt64 Key = Hash(Path);
+
+        const auto Comparator = [](ConstRef<Entry> Item, UInt64 Value)
+        {
+            return Item.Hash < Value;
+        };
+
+        // Entries are sorted by hash; walk every entry sharing the hash to resolve collisions by name.
+        for (auto Iterator = std::lower_bound(mEntries.begin(), mEntries.end(), Key, Comparator);
+             Iterator != mEntries.end() && Iterator->Hash == Key; ++Iterator)
+        {
+            if (Iterator->Name <= mNames.size() && mNames.substr(Iterator->Name, Iterator->NameLength) == Path)
+            {
+                return & (* Iterator);
+            }
+        }
+        return nullptr;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,120 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2025 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Aurora.Content/Locator.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Content
+{
+    // A read-only locator backed by a pack archive.
+    //
+    // The archive is memory mapped once, and its index is sorted by path hash so that lookups do not touch the
+    // filesystem. Uncompressed entries are returned as views into the mapping (zero-copy), therefore any data
+    // returned by this locator must not outlive it.
+    class PackLocator final : public Locator
+    {
+    public:
+
+        // Magic number that identifies a pack archive ('AEPK').
+        static constexpr UInt32 k_Magic       = 0x4B504541;
+
+        // -=(Undocumented)=-
+        static constexpr UInt32 k_Version     = 1;
+
+        // Alignment (in bytes) of every entry's payload within the archive.
+        static constexpr UInt32 k_Alignment   = 16;
+
+        // -=(Undocumented)=-
+        static constexpr UInt16 k_Compressed  = 0b00000001;
+
+        // -=(Undocumented)=-
+        struct Header
+        {
+            UInt32 Magic;
+            UInt32 Version;
+            UInt32 Count;
+            UInt32 Names;
+        };
+
+        // -=(Undocumented)=-
+        struct Entry
+        {
+            UInt64 Hash;
+            UInt64 Offset;
+            UInt32 Size;
+            UInt32 Length;
+            UInt32 Name;
+            UInt16 NameLength;
+            UInt16 Flags;
+        };
+
+    public:
+
+        // -=(Undocumented)=-
+        explicit PackLocator(CStr Filename);
+
+        // -=(Undocumented)=-
+        ~PackLocator() override;
+
+        // -=(Undocumented)=-
+        Bool IsValid() const
+        {
+            return mHeader != nullptr;
+        }
+
+        // \see Locator::Read(CStr)
+        Data Read(CStr Path) override;
+
+        // \see Locator::Write(CStr, CPtr<const UInt8>)
+        Bool Write(CStr Path, CPtr<const UInt8> Bytes) override;
+
+        // \see Locator::Delete(CStr)
+        Bool Delete(CStr Path) override;
+
+        // \see Locator::Contains(CStr)
+        Bool Contains(CStr Path) override;
+
+    public:
+
+        // -=(Undocumented)=-
+        static UInt64 Hash(CStr Path);
+
+    private:
+
+        // -=(Undocumented)=-
+        Bool Map(CStr Filename);
+
+        // -=(Undocumented)=-
+        void Unmap();
+
+        // -=(Undocumented)=-
+        ConstPtr<Entry> Find(CStr Path) const;
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Ptr<void>          mFile;
+        Ptr<void>          mMapping;
+        ConstPtr<UInt8>    mBytes;
+        UInt               mSize;
+        ConstPtr<Header>   mHeader;
+        CPtr<const Entry>  mEntries;
+        CStr               mNames;
+    };
+}
\ No newline at end of file
@@ -12,6 +12,17 @@
 
 #include "SystemLocator.hpp"
 
+#ifdef    SDL_PLATFORM_LINUX
+    #include <sys/inotify.h>
+#endif // SDL_PLATFORM_LINUX
+
+#ifdef    SDL_PLATFORM_WIN32
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif // SDL_PLATFORM_WIN32
+
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 // [   CODE   ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -21,9 +32,48 @@ namespace Content
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-    SystemLocator::SystemLocator(CStr Path)
-        : mPath { CreatePath(Path) }
+    SystemLocator::SystemLocator(CStr Path, Bool Watch, Durability Policy)
+        : mPath       { CreatePath(Path) },
+          mWatch      { Watch },
+          mDurability { Policy },
+          mNotifier   { -1 },
+          mLastPoll   { 0 },
+          mIndexed    { false },
+          mBusy       { false }
     {
+#ifdef    SDL_PLATFORM_LINUX
+        // Prefer native notifications for the whole tree, otherwise fall back to polling the files
+        // that have been read.
+        if (mWatch)
+        {
+            mNotifier = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+            if (mNotifier >= 0)
+            {
+                Observe("");
+            }
+        }
+#endif // SDL_PLATFORM_LINUX
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    SystemLocator::~SystemLocator()
+    {
+        // The writer drains the queue before exiting, so that no write handed off is lost.
+        if (mWriter.joinable())
+        {
+            mWriter.request_stop();
+            mWriter.join();
+        }
+
+#ifdef    SDL_PLATFORM_LINUX
+        if (mNotifier >= 0)
+        {
+            ::close(mNotifier);
+        }
+#endif // SDL_PLATFORM_LINUX
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -31,6 +81,34 @@ namespace Content
 
     Data SystemLocator::Read(CStr Path)
     {
+        // Writes that have not reached the file yet take precedence over its content.
+        {
+            std::lock_guard Guard(mWriteMutex);
+
+            ConstPtr<Request> Pending = nullptr;
+
+            if (const auto Iterator = mWrites.find(Path); Iterator != mWrites.end())
+            {
+                Pending = & Iterator->second;
+            }
+            else if (mBusy && mActivePath == Path)
+            {
+                Pending = & mActive;
+            }
+
+            if (Pending)
+            {
+                Data Result;
+
+                if (! Pending->Remove)
+                {
+                    Result = Data(Pending->Bytes.GetSize());
+                    Result.Copy(Pending->Bytes.GetData<UInt8>(), Pending->Bytes.GetSize());
+                }
+                return Result;
+            }
+        }
+
         if (const Ptr<SDL_IOStream> Stream = SDL_IOFromFile(Format("{}{}", mPath, Path).c_str(), "r+b"); Stream)
         {
             Data Result(SDL_GetIOSize(Stream));
@@ -38,6 +116,11 @@ namespace Content
             SDL_ReadIO(Stream, Result.GetData(), Result.GetSize());
             SDL_CloseIO(Stream);
 
+            if (mWatch && mNotifier < 0)
+            {
+                Track(Path);
+            }
+
             return Result;
         }
         return Data();
@@ -46,21 +129,535 @@ namespace Content
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-    void SystemLocator::Write(CStr Path, CPtr<const UInt8> Bytes)
+    Bool SystemLocator::Write(CStr Path, CPtr<const UInt8> Bytes)
+    {
+        // Go through the writer as well, so that the write is ordered after the ones already handed off.
+        Data Copy(Bytes.size());
+        Copy.Copy(Bytes.data(), Bytes.size());
+
+        return Submit(Path, Move(Copy), false)->Wait();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool SystemLocator::Delete(CStr Path)
+    {
+        return Submit(Path, Data(), true)->Wait();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    SPtr<Ticket> SystemLocator::Enqueue(CStr Path, Any<Data> Bytes)
+    {
+        return Submit(Path, Move(Bytes), false);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void SystemLocator::Flush()
+    {
+        std::unique_lock Lock(mWriteMutex);
+        mWriteCondition.wait(Lock, [this] { return mOrder.empty() && ! mBusy; });
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool SystemLocator::Contains(CStr Path)
     {
-        if (const Ptr<SDL_IOStream> Stream = SDL_IOFromFile(Format("{}{}", mPath, Path).c_str(), "w+b"); Stream)
         {
-            SDL_WriteIO(Stream, Bytes.data(), Bytes.size());
-            SDL_CloseIO(Stream);
+            std::lock_guard Guard(mWriteMutex);
+
+            if (const auto Iterator = mWrites.find(Path); Iterator != mWrites.end())
+            {
+                return ! Iterator->second.Remove;
+            }
+
+            if (mBusy && mActivePath == Path)
+            {
+                return ! mActive.Remove;
+            }
+        }
+
+        std::lock_guard Guard(mMutex);
+
+        // Build the index on the first query rather than when mounted, so that locators never queried
+        // do not pay for walking their tree.
+        if (! mIndexed)
+        {
+            mIndexed = true;
+
+            mIndex.clear();
+            Index("");
+        }
+        return mIndex.contains(GetKey(Path));
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void SystemLocator::Rescan()
+    {
+        std::lock_guard Guard(mMutex);
+
+        mIndexed = false;
+        mIndex.clear();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void SystemLocator::Poll(Ref<Vector<SStr>> Changes)
+    {
+        if (! mWatch)
+        {
+            return;
+        }
+
+#ifdef    SDL_PLATFORM_LINUX
+        if (mNotifier >= 0)
+        {
+            alignas(inotify_event) Char Buffer[4096];
+            Bool                       Overflow = false;
+
+            for (SInt Length; (Length = ::read(mNotifier, Buffer, sizeof(Buffer))) > 0;)
+            {
+                for (SInt Offset = 0; Offset < Length;)
+                {
+                    const ConstPtr<inotify_event> Event = reinterpret_cast<ConstPtr<inotify_event>>(Buffer + Offset);
+                    Offset += sizeof(inotify_event) + Event->len;
+
+                    if (Event->mask & IN_Q_OVERFLOW)
+                    {
+                        Overflow = true;
+                        continue;
+                    }
+
+                    const auto Iterator = mFolders.find(Event->wd);
+
+                    if (Event->len == 0 || Iterator == mFolders.end())
+                    {
+                        continue;
+                    }
+
+                    const SStr Path = Iterator->second.empty()
+                        ? SStr(Event->name)
+                        : Format("{}/{}", Iterator->second, Event->name);
+
+                    // Files being written are only reported once renamed over their destination.
+                    if (Path.ends_with(k_PartialSuffix))
+                    {
+                        continue;
+                    }
+
+                    if (Event->mask & IN_ISDIR)
+                    {
+                        if (Event->mask & (IN_CREATE | IN_MOVED_TO))
+                        {
+                            Observe(Path);
+
+                            std::lock_guard Guard(mMutex);
+
+                            if (mIndexed)
+                            {
+                                Index(Path);
+                            }
+                        }
+                    }
+                    else if (Event->mask & (IN_DELETE | IN_MOVED_FROM))
+                    {
+                        std::lock_guard Guard(mMutex);
+                        mIndex.erase(GetKey(Path));
+                    }
+                    else if (Event->mask & (IN_CLOSE_WRITE | IN_MOVED_TO))
+                    {
+                        std::lock_guard Guard(mMutex);
+                        mIndex.emplace(GetKey(Path));
+
+                        // Skip the renames that committed the locator's own writes.
+                        if (Event->mask & IN_MOVED_TO)
+                        {
+                            if (const auto Committed = mCommitted.find(Path); Committed != mCommitted.end())
+                            {
+                                if (--Committed->second == 0)
+                                {
+                                    mCommitted.erase(Committed);
+                                }
+                                continue;
+                            }
+                        }
+                        Changes.emplace_back(Path);
+                    }
+                }
+            }
+
+            // Events have been dropped, so anything may have changed: watch the folders created meanwhile and
+            // report every file as changed.
+            if (Overflow)
+            {
+                Log::Warn("Resources: Notifications for '{}' overflowed, rescanning", mPath);
+
+                Observe("");
+                Rescan();
+
+                std::lock_guard Guard(mMutex);
+
+                mIndexed = true;
+                mCommitted.clear();
+                Index("", & Changes);
+            }
+            return;
+        }
+#endif // SDL_PLATFORM_LINUX
+
+        // Scan the files that have been read so far, comparing their modification time.
+        if (const UInt64 Now = SDL_GetTicks(); Now - mLastPoll >= k_PollInterval)
+        {
+            mLastPoll = Now;
+
+            std::lock_guard Guard(mMutex);
+
+            for (auto & [Path, Timestamp] : mTimestamps)
+            {
+                SDL_PathInfo Information;
+
+                if (SDL_GetPathInfo(Format("{}{}", mPath, Path).c_str(), & Information) && Information.modify_time != Timestamp)
+                {
+                    Timestamp = Information.modify_time;
+
+                    Changes.emplace_back(Path);
+                }
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void SystemLocator::Observe(ConstRef<SStr> Folder)
+    {
+#ifdef    SDL_PLATFORM_LINUX
+        const SStr Directory = Format("{}{}", mPath, Folder);
+
+        const SInt32 Descriptor = ::inotify_add_watch(
+            mNotifier, Directory.empty() ? "." : Directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_DELETE | IN_MOVED_FROM);
+
+        if (Descriptor < 0)
+        {
+            Log::Warn("Resources: Failed to watch '{}'", Directory);
+            return;
+        }
+        mFolders[Descriptor] = Folder;
+
+        // Watch every sub-folder as well, since notifications are not recursive.
+        Vector<SStr> Children;
+
+        const auto OnEnumerate = [](Ptr<void> User, ConstPtr<Char> Directory, ConstPtr<Char> Name)
+        {
+            static_cast<Ptr<Vector<SStr>>>(User)->emplace_back(Name);
+            return SDL_ENUM_CONTINUE;
+        };
+        SDL_EnumerateDirectory(Directory.empty() ? "." : Directory.c_str(), OnEnumerate, & Children);
+
+        for (ConstRef<SStr> Child : Children)
+        {
+            const SStr Path = Folder.empty() ? Child : Format("{}/{}", Folder, Child);
+
+            if (SDL_PathInfo Information; SDL_GetPathInfo(Format("{}{}", mPath, Path).c_str(), & Information))
+            {
+                if (Information.type == SDL_PATHTYPE_DIRECTORY)
+                {
+                    Observe(Path);
+                }
+            }
+        }
+#endif // SDL_PLATFORM_LINUX
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void SystemLocator::Track(CStr Path)
+    {
+        std::lock_guard Guard(mMutex);
+
+        if (mTimestamps.find(Path) == mTimestamps.end())
+        {
+            SDL_PathInfo Information;
+
+            if (SDL_GetPathInfo(Format("{}{}", mPath, Path).c_str(), & Information))
+            {
+                mTimestamps.try_emplace(Path, Information.modify_time);
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void SystemLocator::Index(ConstRef<SStr> Folder, Ptr<Vector<SStr>> Files)
+    {
+        const SStr Directory = Format("{}{}", mPath, Folder);
+
+        Vector<SStr> Children;
+
+        const auto OnEnumerate = [](Ptr<void> User, ConstPtr<Char> Directory, ConstPtr<Char> Name)
+        {
+            static_cast<Ptr<Vector<SStr>>>(User)->emplace_back(Name);
+            return SDL_ENUM_CONTINUE;
+        };
+        SDL_EnumerateDirectory(Directory.empty() ? "." : Directory.c_str(), OnEnumerate, & Children);
+
+        for (ConstRef<SStr> Child : Children)
+        {
+            const SStr Path = Folder.empty() ? Child : Format("{}/{}", Folder, Child);
+
+            if (SDL_PathInfo Information; SDL_GetPathInfo(Format("{}{}", mPath, Path).c_str(), & Information))
+            {
+                if (Information.type == SDL_PATHTYPE_DIRECTORY)
+                {
+                    Index(Path, Files);
+                }
+                else if (! Path.ends_with(k_PartialSuffix))
+                {
+                    mIndex.emplace(GetKey(Path));
+
+                    if (Files)
+                    {
+                        Files->emplace_back(Path);
+                    }
+                }
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    SPtr<Ticket> SystemLocator::Submit(CStr Path, Any<Data> Bytes, Bool Remove)
+    {
+        const SPtr<Ticket> Token = NewPtr<Ticket>();
+
+        {
+            std::lock_guard Guard(mWriteMutex);
+
+            // A write to a path that is still queued replaces it, the previous tickets complete along with it.
+            auto [Iterator, Inserted] = mWrites.try_emplace(Path);
+
+            if (Inserted)
+            {
+                mOrder.emplace_back(Path);
+            }
+
+            Iterator->second.Bytes  = Move(Bytes);
+            Iterator->second.Remove = Remove;
+            Iterator->second.Tickets.emplace_back(Token);
+
+            if (! mWriter.joinable())
+            {
+                mWriter = Thread([this](std::stop_token Token) { OnWrite(Token); });
+            }
+        }
+        mWriteCondition.notify_all();
+
+        return Token;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool SystemLocator::Commit(ConstRef<SStr> Path, ConstRef<Data> Bytes, Bool Remove)
+    {
+        const SStr Filename = Format("{}{}", mPath, Path);
+
+        if (Remove)
+        {
+            return SDL_RemovePath(Filename.c_str());
+        }
+
+        // Write into a sibling file and rename it over the destination, so that readers never observe a
+        // partially written file, even if the process dies halfway.
+        const SStr Partial = Filename + SStr(k_PartialSuffix);
+
+        const Ptr<SDL_IOStream> Stream = SDL_IOFromFile(Partial.c_str(), "wb");
+
+        if (! Stream)
+        {
+            Log::Warn("Resources: Failed to write '{}'", Filename);
+            return false;
+        }
+
+        Bool Result = (SDL_WriteIO(Stream, Bytes.GetData(), Bytes.GetSize()) == Bytes.GetSize());
+        Result      = SDL_CloseIO(Stream) && Result;
+
+        if (Result && mDurability == Durability::Strict)
+        {
+            Result = Synchronize(Partial);
+        }
+
+        if (Result)
+        {
+            Result = SDL_RenamePath(Partial.c_str(), Filename.c_str());
+        }
+
+        if (! Result)
+        {
+            Log::Warn("Resources: Failed to write '{}'", Filename);
+
+            SDL_RemovePath(Partial.c_str());
+            return false;
+        }
+
+        // Persist the rename itself, which is recorded by the folder rather than by the file.
+        if (mDurability == Durability::Strict)
+        {
+            const UInt Separator = Filename.find_last_of('/');
+            Synchronize(Separator == SStr::npos ? "." : Filename.substr(0, Separator));
+        }
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void SystemLocator::OnWrite(std::stop_token Token)
+    {
+        while (true)
+        {
+            Vector<SPtr<Ticket>> Tickets;
+            {
+                std::unique_lock Lock(mWriteMutex);
+
+                // Sleep until a write is handed off, once stopped keep going until the queue has been drained.
+                if (! mWriteCondition.wait(Lock, Token, [this] { return ! mOrder.empty(); }))
+                {
+                    break;
+                }
+
+                mActivePath = Move(mOrder.front());
+                mOrder.pop_front();
+
+                const auto Iterator = mWrites.find(mActivePath);
+                mActive = Move(Iterator->second);
+                mWrites.erase(Iterator);
+
+                mBusy = true;
+            }
+
+            // Record the rename before it happens, so that a poll racing with it still recognizes it as ours.
+            const Bool Silence = (mNotifier >= 0 && ! mActive.Remove);
+
+            if (Silence)
+            {
+                std::lock_guard Guard(mMutex);
+                ++mCommitted[mActivePath];
+            }
+
+            // The active request is only replaced by this thread, so it can be read without holding the lock.
+            const Bool Result = Commit(mActivePath, mActive.Bytes, mActive.Remove);
+
+            // Update the index once the file is in place, queries see the request as pending until then.
+            {
+                std::lock_guard Guard(mMutex);
+
+                if (! Result)
+                {
+                    if (const auto Committed = mCommitted.find(mActivePath); Silence && Committed != mCommitted.end())
+                    {
+                        if (--Committed->second == 0)
+                        {
+                            mCommitted.erase(Committed);
+                        }
+                    }
+                }
+                else if (mActive.Remove)
+                {
+                    mIndex.erase(GetKey(mActivePath));
+                }
+                else
+                {
+                    mIndex.emplace(GetKey(mActivePath));
+
+                    // Files being polled take the new timestamp, so that the write is not reported as a change.
+                    if (const auto Timestamp = mTimestamps.find(mActivePath); Timestamp != mTimestamps.end())
+                    {
+                        if (SDL_PathInfo Information; SDL_GetPathInfo(Format("{}{}", mPath, mActivePath).c_str(), & Information))
+                        {
+                            Timestamp->second = Information.modify_time;
+                        }
+                    }
+                }
+            }
+
+            {
+                std::lock_guard Guard(mWriteMutex);
+
+                Tickets = Move(mActive.Tickets);
+
+                mActive = Request();
+                mBusy   = false;
+            }
+            mWriteCondition.notify_all();
+
+            for (ConstSPtr<Ticket> Ticket : Tickets)
+            {
+                Ticket->Complete(Result);
+            }
         }
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-    void SystemLocator::Delete(CStr Path)
+    Bool SystemLocator::Synchronize(ConstRef<SStr> Path)
     {
-        SDL_RemovePath(Format("{}{}", mPath, Path).c_str());
+#ifdef    SDL_PLATFORM_WIN32
+        // Directories can only be opened with backup semantics.
+        const HANDLE File = ::CreateFileA(
+            Path.c_str(), GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING,
+            FILE_FLAG_BACKUP_SEMANTICS, nullptr);
+
+        if (File == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+        const Bool Result = ::FlushFileBuffers(File);
+        ::CloseHandle(File);
+        return Result;
+#else
+        const SInt32 Descriptor = ::open(Path.c_str(), O_RDONLY | O_CLOEXEC);
+
+        if (Descriptor < 0)
+        {
+            return false;
+        }
+        const Bool Result = (::fsync(Descriptor) == 0);
+        ::close(Descriptor);
+        return Result;
+#endif // SDL_PLATFORM_WIN32
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    AssetId SystemLocator::GetKey(CStr Path)
+    {
+#if defined(SDL_PLATFORM_WIN32) || defined(SDL_PLATFORM_MACOS)
+        // Folding may report a file that a case sensitive volume does not hold, which the locator is allowed to do,
+        // whereas reporting a file as missing when it opens is not.
+        SStr Folded(Path);
+
+        for (Ref<Char> Letter : Folded)
+        {
+            Letter = static_cast<Char>(std::tolower(static_cast<UInt8>(Letter)));
+        }
+        return AssetId(Folded);
+#else
+        return AssetId(Path);
+#endif
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
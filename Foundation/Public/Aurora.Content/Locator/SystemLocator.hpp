@@ -13,6 +13,10 @@
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
 #include "Aurora.Content/Locator.hpp"
+#include "Aurora.Content/Uri.hpp"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 // [   CODE   ]
@@ -23,33 +27,123 @@ namespace Content
     // -=(Undocumented)=-
     class SystemLocator final : public Locator
     {
+    public:
+
+        // Interval (in milliseconds) between scans of the files read, when native notifications are unavailable.
+        static constexpr UInt64 k_PollInterval = 500;
+
+        // Suffix of the file being written, which replaces the destination once complete.
+        static constexpr CStr   k_PartialSuffix = ".partial";
+
+        // Guarantee given by a write once its ticket has completed.
+        enum class Durability
+        {
+            Relaxed,    // The file is replaced atomically, but may be lost on power failure.
+            Strict,     // The file and its folder are synchronized to the storage as well.
+        };
+
     public:
 
         // -=(Undocumented)=-
-        explicit SystemLocator(CStr Path = "");
+        explicit SystemLocator(CStr Path = "", Bool Watch = false, Durability Policy = Durability::Relaxed);
 
         // -=(Undocumented)=-
-        ~SystemLocator() override = default;
+        ~SystemLocator() override;
 
         // \see Locator::Read(CStr)
         Data Read(CStr Path) override;
 
         // \see Locator::Write(CStr, CPtr<const UInt8>)
-        void Write(CStr Path, CPtr<const UInt8> Bytes) override;
+        Bool Write(CStr Path, CPtr<const UInt8> Bytes) override;
 
         // \see Locator::Delete(CStr)
-        void Delete(CStr Path) override;
+        Bool Delete(CStr Path) override;
+
+        // \see Locator::Enqueue(CStr, Any<Data>)
+        SPtr<Ticket> Enqueue(CStr Path, Any<Data> Bytes) override;
+
+        // \see Locator::Flush()
+        void Flush() override;
+
+        // \see Locator::Contains(CStr)
+        Bool Contains(CStr Path) override;
+
+        // \see Locator::Rescan()
+        void Rescan() override;
+
+        // \see Locator::Poll(Ref<Vector<SStr>>)
+        void Poll(Ref<Vector<SStr>> Changes) override;
 
     private:
 
+        // -=(Undocumented)=-
+        void Observe(ConstRef<SStr> Folder);
+
+        // -=(Undocumented)=-
+        void Track(CStr Path);
+
+        // Indexes every file under the folder, appending their paths to the list given.
+        void Index(ConstRef<SStr> Folder, Ptr<Vector<SStr>> Files = nullptr);
+
+        // -=(Undocumented)=-
+        SPtr<Ticket> Submit(CStr Path, Any<Data> Bytes, Bool Remove);
+
+        // -=(Undocumented)=-
+        Bool Commit(ConstRef<SStr> Path, ConstRef<Data> Bytes, Bool Remove);
+
+        // -=(Undocumented)=-
+        void OnWrite(std::stop_token Token);
+
+        // -=(Undocumented)=-
+        static Bool Synchronize(ConstRef<SStr> Path);
+
+        // Returns the key a path is indexed under, folding its case on platforms whose filesystems ignore it.
+        static AssetId GetKey(CStr Path);
+
         // -=(Undocumented)=-
         static SStr CreatePath(CStr Path);
 
     private:
 
+        // -=(Undocumented)=-
+        struct Request
+        {
+            Data                 Bytes;
+            Bool                 Remove = false;
+            Vector<SPtr<Ticket>> Tickets;
+        };
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        const SStr          mPath;
+        const Bool          mWatch;
+        const Durability    mDurability;
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        SInt32              mNotifier;
+        Table<SInt32, SStr> mFolders;
+        std::mutex          mMutex;
+        StringTable<SInt64> mTimestamps;
+        UInt64              mLastPoll;
+        Set<AssetId>        mIndex;
+        Bool                mIndexed;
+        StringTable<UInt32> mCommitted;
+
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-        const SStr mPath;
+        std::mutex                  mWriteMutex;
+        std::condition_variable_any mWriteCondition;
+        StringTable<Request>        mWrites;
+        std::deque<SStr>            mOrder;
+        SStr                        mActivePath;
+        Request                     mActive;
+        Bool                        mBusy;
+        Thread                      mWriter;
     };
 }
\ No newline at end of file
@@ -13,6 +13,7 @@
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
 #include "Factory.hpp"
+#include <mutex>
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 // [   CODE   ]
@@ -23,12 +24,15 @@ namespace Content
     // -=(Undocumented)=-
     class Resource
     {
+        template<typename Type>
+        friend class Factory;
+
     public:
 
         // -=(Undocumented)=-
         enum class Status
         {
-            None, Loaded, Failed
+            None, Loading, Loaded, Failed
         };
 
     public:
@@ -37,7 +41,10 @@ namespace Content
         explicit Resource(Any<Uri> Key)
             : mKey      { Move(Key) },
               mMemory   { 0 },
-              mStatus   { Status::None }
+              mStatus   { Status::None },
+              mCreated  { false },
+              mOwner    { nullptr },
+              mLastUse  { 0 }
         {
         }
 
@@ -47,12 +54,29 @@ namespace Content
         // -=(Undocumented)=-
         Bool Create(Ref<Subsystem::Context> Context)
         {
-            Delete(Context);
+            // Release the previous instance in place, without going through 'None', so that a concurrent
+            // load request never observes the asset as unclaimed while it is being finalized. A reloaded asset
+            // is 'Loading' by then, hence the instance is tracked apart from the status.
+            if (mCreated)
+            {
+                OnDelete(Context);
+
+                if (mOwner)
+                {
+                    mOwner->SubMemoryUsage(GetMemory());
+                }
+            }
+            SetMemory(0);
 
             const Bool Result = OnCreate(Context);
+            mCreated = Result;
 
             if (Result)
             {
+                if (mOwner)
+                {
+                    mOwner->AddMemoryUsage(GetMemory());
+                }
                 SetStatus(Status::Loaded);
             }
             else
@@ -65,11 +89,17 @@ namespace Content
         // -=(Undocumented)=-
         void Delete(Ref<Subsystem::Context> Context)
         {
-            if (HasLoaded())
+            if (mCreated)
             {
                 OnDelete(Context);
+
+                if (mOwner)
+                {
+                    mOwner->SubMemoryUsage(GetMemory());
+                }
             }
 
+            mCreated = false;
             SetStatus(Status::None);
             SetMemory(0);
         }
@@ -95,31 +125,102 @@ namespace Content
         // -=(Undocumented)=-
         void SetStatus(Status Status)
         {
-            mStatus = Status;
+            mStatus.store(Status, std::memory_order_release);
+        }
+
+        // -=(Undocumented)=-
+        Bool TrySetStatus(Status Expected, Status Desired)
+        {
+            return mStatus.compare_exchange_strong(Expected, Desired, std::memory_order_acq_rel);
         }
 
         // -=(Undocumented)=-
         Status GetStatus() const
         {
-            return mStatus;
+            return mStatus.load(std::memory_order_acquire);
+        }
+
+        // Declares that the asset is built on top of the given one, rejecting the edge if it would close a cycle.
+        Bool AddDependency(ConstSPtr<Resource> Dependency)
+        {
+            std::lock_guard Guard(GetGraphMutex());
+
+            if (Dependency->Reaches(this))
+            {
+                return false;
+            }
+            mDependencies.emplace_back(Dependency);
+            return true;
+        }
+
+        // Declares a file the asset is built from besides its own, such as a sidecar holding its import options, so
+        // that the asset is reloaded whenever the file changes.
+        void AddFile(AssetId File)
+        {
+            std::lock_guard Guard(GetGraphMutex());
+            mFiles.emplace_back(File);
+        }
+
+        // Whether the asset is built from the given file, besides its own.
+        Bool HasFile(AssetId File) const
+        {
+            std::lock_guard Guard(GetGraphMutex());
+
+            return std::any_of(mFiles.begin(), mFiles.end(), [File](AssetId Entry)
+            {
+                return Entry.IsSameFile(File);
+            });
+        }
+
+        // Forgets every dependency of the asset, assets and files alike.
+        void ClearDependencies()
+        {
+            std::lock_guard Guard(GetGraphMutex());
+            mDependencies.clear();
+            mFiles.clear();
+        }
+
+        // Returns a snapshot of the asset's direct dependencies, since loaders may declare them concurrently.
+        Vector<SPtr<Resource>> GetDependencies() const
+        {
+            std::lock_guard Guard(GetGraphMutex());
+            return mDependencies;
+        }
+
+        // Whether any of the asset's direct dependencies is still being loaded.
+        Bool HasPendingDependencies() const
+        {
+            std::lock_guard Guard(GetGraphMutex());
+
+            return std::any_of(mDependencies.begin(), mDependencies.end(), [](ConstSPtr<Resource> Dependency)
+            {
+                return Dependency->IsLoading();
+            });
+        }
+
+        // -=(Undocumented)=-
+        Bool IsLoading() const
+        {
+            return GetStatus() == Status::Loading;
         }
 
         // -=(Undocumented)=-
         Bool HasFinished() const
         {
-            return mStatus != Status::None;
+            const Status Current = GetStatus();
+            return Current == Status::Loaded || Current == Status::Failed;
         }
 
         // -=(Undocumented)=-
         Bool HasFailed() const
         {
-            return mStatus == Status::Failed;
+            return GetStatus() == Status::Failed;
         }
 
         // -=(Undocumented)=-
         Bool HasLoaded() const
         {
-            return mStatus == Status::Loaded;
+            return GetStatus() == Status::Loaded;
         }
 
     protected:
@@ -137,12 +238,39 @@ namespace Content
 
     private:
 
+        // Guards the dependency graph, which loaders extend from every worker while the main thread walks it.
+        static Ref<std::mutex> GetGraphMutex()
+        {
+            static std::mutex Mutex;
+            return Mutex;
+        }
+
+        // Whether the given asset is this one or any of its dependencies, directly or indirectly; the graph
+        // must be locked by the caller.
+        Bool Reaches(ConstPtr<Resource> Asset) const
+        {
+            if (this == Asset)
+            {
+                return true;
+            }
+
+            return std::any_of(mDependencies.begin(), mDependencies.end(), [Asset](ConstSPtr<Resource> Dependency)
+            {
+                return Dependency->Reaches(Asset);
+            });
+        }
+
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-        const Uri  mKey;
-        UInt       mMemory;
-        Status     mStatus;
+        const Uri              mKey;
+        UInt                   mMemory;
+        Atomic<Status>         mStatus;
+        Bool                   mCreated;
+        Ptr<FactoryBase>       mOwner;
+        Atomic<UInt64>         mLastUse;
+        Vector<SPtr<Resource>> mDependencies;
+        Vector<AssetId>        mFiles;
     };
 
     // -=(Undocumented)=-
@@ -157,28 +285,6 @@ namespace Content
         {
         }
 
-    protected:
-
-        // -=(Undocumented)=-
-        Bool OnCreate(Ref<Subsystem::Context> Context) override
-        {
-            const Bool Result = static_cast<Ptr<Impl>>(this)->OnCreate(Context);
-
-            if (Result)
-            {
-                GetFactory().AddMemoryUsage(GetMemory());
-            }
-            return Result;
-        }
-
-        // -=(Undocumented)=-
-        void OnDelete(Ref<Subsystem::Context> Context) override
-        {
-            GetFactory().AddMemoryUsage(-GetMemory());
-
-            static_cast<Ptr<Impl>>(this)->OnDelete(Context);
-        }
-
     public:
 
         // -=(Undocumented)=-
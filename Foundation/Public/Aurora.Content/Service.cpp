@@ -11,6 +11,7 @@
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
 #include "Service.hpp"
+#include "Aurora.Base/Checksum.hpp"
 #include "Locator/MemoryLocator.hpp"
 
 #ifdef    AE_CONTENT_LOADER_MP3
@@ -20,8 +21,13 @@
     #include "Aurora.Content/Sound/WAV/Loader.hpp"
 #endif // AE_CONTENT_LOADER_WAV
 #ifdef    AE_CONTENT_LOADER_STB
+    #include "Aurora.Graphic/Service.hpp"
     #include "Aurora.Content/Texture/STB/Loader.hpp"
 #endif // AE_CONTENT_LOADER_STB
+#ifdef    AE_CONTENT_LOADER_KTX
+    #include "Aurora.Graphic/Service.hpp"
+    #include "Aurora.Content/Texture/KTX/Loader.hpp"
+#endif // AE_CONTENT_LOADER_KTX
 #ifdef    AE_CONTENT_LOADER_EFFECT
     #include "Aurora.Content/Shader/Loader.hpp"
 #endif // AE_CONTENT_LOADER_EFFECT
@@ -45,13 +51,120 @@
 
 namespace Content
 {
+    // Magic number that identifies a cache entry ('AECT').
+    static constexpr UInt32 k_CacheMagic = 0x54434541;
+
+    // Trails the payload of every cache entry, so that the payload can be handed out in the buffer it was read into.
+    struct CacheHeader
+    {
+        UInt32 Magic;
+        UInt32 Checksum;
+        UInt64 Hash;
+    };
+
+    // Whether the calling thread belongs to the worker pool.
+    static thread_local Bool s_Worker = false;
+
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
     Service::Service(Ref<Context> Context)
-        : AbstractSubsystem(Context)
+        : AbstractSubsystem(Context),
+          mBudget { k_DefaultFinalizeBudget }
     {
         RegisterDefaultResources();
+
+        // Spawn the worker pool used to read and parse assets in the background, leaving one
+        // logical core to the main thread which finalizes them.
+        const UInt32 Workers = std::max(SDL_GetNumLogicalCPUCores() - 1, 1);
+
+        for (UInt32 Index = 0; Index < Workers; ++Index)
+        {
+            mWorkers.emplace_back(std::bind_front(&Service::OnWork, this));
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Service::OnDispose()
+    {
+        // Signal every worker to stop; workers sleeping on the pending queue are woken up by the
+        // stop token, while busy workers exit as soon as they finish parsing their current asset.
+        for (Ref<Thread> Worker : mWorkers)
+        {
+            Worker.request_stop();
+        }
+
+        for (Ref<Thread> Worker : mWorkers)
+        {
+            Worker.join();
+        }
+        mWorkers.clear();
+
+        // Any asset still in flight is dropped and flagged as failed.
+        for (ConstSPtr<Resource> Asset : mPending)
+        {
+            Asset->SetStatus(Resource::Status::Failed);
+        }
+        mPending.clear();
+
+        // Every batch is finished by the thread that dispatched it, the helpers left behind have nothing to do.
+        mJobs.clear();
+
+        for (ConstRef<Completion> Entry : mCompleted)
+        {
+            Entry.Asset->SetStatus(Resource::Status::Failed);
+        }
+        mCompleted.clear();
+
+        for (ConstRef<Completion> Entry : mDeferred)
+        {
+            Entry.Asset->SetStatus(Resource::Status::Failed);
+        }
+        mDeferred.clear();
+        mCallbacks.clear();
+
+#ifdef    AE_CONTENT_LOADER_EFFECT
+        // The driver outlives this service, hence it must stop reaching the cache through it.
+        if (ConstSPtr<Graphic::Service> Graphics = GetSubsystem<Graphic::Service>())
+        {
+            Graphics->SetPipelineCache(Graphic::PipelineCache());
+        }
+#endif // AE_CONTENT_LOADER_EFFECT
+
+        // Every write handed off must reach the storage before shutting down.
+        std::shared_lock Guard(mRegistryMutex);
+
+        for (const auto & [_, Locator] : mLocators)
+        {
+            Locator->Flush();
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Service::OnTick(ConstRef<Time> Time)
+    {
+        const UInt64 Start = SDL_GetPerformanceCounter();
+        const UInt64 Limit = static_cast<UInt64>(mBudget * SDL_GetPerformanceFrequency());
+
+        // Finalize assets that have been parsed by the worker pool until the time budget is exhausted,
+        // creating at least one each tick so that the queue always makes progress.
+        while (Finalize())
+        {
+            if (SDL_GetPerformanceCounter() - Start >= Limit)
+            {
+                break;
+            }
+        }
+
+        // Reload the assets whose files have changed on disk, now that no asset is being finalized.
+        Watch(Time.GetAbsolute());
+
+        // Keep every factory within its memory budget.
+        Evict();
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -59,6 +172,8 @@ namespace Content
 
     void Service::AddLoader(ConstSPtr<Loader> Loader)
     {
+        std::unique_lock Guard(mRegistryMutex);
+
         for (const CStr Extension : Loader->GetExtensions())
         {
             mLoaders.try_emplace(Extension, Loader);
@@ -70,15 +185,29 @@ namespace Content
 
     void Service::RemoveLoader(CStr Extension)
     {
+        std::unique_lock Guard(mRegistryMutex);
         mLoaders.erase(Extension);
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+    Bool Service::HasLoader(CStr Extension) const
+    {
+        std::shared_lock Guard(mRegistryMutex);
+        return mLoaders.find(Extension) != mLoaders.end();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
     void Service::AddLocator(CStr Schema, ConstSPtr<Locator> Locator)
     {
-        mLocators.try_emplace(Schema, Locator);
+        {
+            std::unique_lock Guard(mRegistryMutex);
+            mLocators.try_emplace(Schema, Locator);
+        }
+        ClearMissing();
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -86,7 +215,27 @@ namespace Content
 
     void Service::RemoveLocator(CStr Schema)
     {
-        mLocators.erase(Schema);
+        {
+            std::unique_lock Guard(mRegistryMutex);
+            mLocators.erase(Schema);
+        }
+        ClearMissing();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Service::Rescan()
+    {
+        {
+            std::shared_lock Guard(mRegistryMutex);
+
+            for (const auto & [_, Locator] : mLocators)
+            {
+                Locator->Rescan();
+            }
+        }
+        ClearMissing();
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -94,18 +243,43 @@ namespace Content
 
     Data Service::Find(ConstRef<Uri> Key)
     {
-        if (const auto It = mLocators.find(Key.GetSchema()); It != mLocators.end())
+        // The fragment selects how the asset is loaded, it is not part of the file's path.
+        const CStr   Url  = Key.GetUrlWithoutFragment();
+        const CStr   Path = Key.GetPathWithoutFragment();
+        const UInt64 Hash = XXHash64(CPtr<const UInt8>(reinterpret_cast<ConstPtr<UInt8>>(Url.data()), Url.size()));
+
+        if (IsMissing(Hash))
         {
-            return It->second->Read(Key.GetPath());
+            return Data();
         }
 
-        for (const auto & [_, Locator] : mLocators)
+        std::shared_lock Guard(mRegistryMutex);
+
+        if (const auto It = mLocators.find(Key.GetSchema()); It != mLocators.end())
         {
-            if (Data Data = Locator->Read(Key.GetPath()); Data.HasData())
+            if (Data Data = It->second->Read(Path); Data.HasData())
             {
                 return Move(Data);
             }
         }
+        else
+        {
+            // Only read from locators that may hold the file, so that a lookup touches the filesystem once at most.
+            for (const auto & [_, Locator] : mLocators)
+            {
+                if (! Locator->Contains(Path))
+                {
+                    continue;
+                }
+
+                if (Data Data = Locator->Read(Path); Data.HasData())
+                {
+                    return Move(Data);
+                }
+            }
+        }
+
+        SetMissing(Hash);
         return Data();
     }
 
@@ -114,10 +288,14 @@ namespace Content
 
     Bool Service::Save(ConstRef<Uri> Key, CPtr<const UInt8> Data)
     {
+        std::shared_lock Guard(mRegistryMutex);
+
         if (const auto It = mLocators.find(Key.GetSchema()); It != mLocators.end())
         {
-            It->second->Write(Key.GetPath(), Data);
-            return true;
+            const Bool Result = It->second->Write(Key.GetPath(), Data);
+
+            ClearMissing();
+            return Result;
         }
         return false;
     }
@@ -125,12 +303,132 @@ namespace Content
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+    SPtr<Ticket> Service::SaveAsync(ConstRef<Uri> Key, Any<Data> Bytes)
+    {
+        std::shared_lock Guard(mRegistryMutex);
+
+        if (const auto It = mLocators.find(Key.GetSchema()); It != mLocators.end())
+        {
+            SPtr<Ticket> Token = It->second->Enqueue(Key.GetPath(), Move(Bytes));
+
+            ClearMissing();
+            return Token;
+        }
+        return nullptr;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
     Bool Service::Delete(ConstRef<Uri> Key)
     {
+        std::shared_lock Guard(mRegistryMutex);
+
         if (const auto It = mLocators.find(Key.GetSchema()); It != mLocators.end())
         {
-            It->second->Delete(Key.GetPath());
-            return true;
+            return It->second->Delete(Key.GetPath());
+        }
+        return false;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Data Service::FindCache(CStr Name, UInt64 Hash)
+    {
+        std::shared_lock Guard(mRegistryMutex);
+
+        const auto It = mLocators.find(k_CacheSchema);
+
+        if (It == mLocators.end())
+        {
+            return Data();
+        }
+
+        Data Entry = It->second->Read(Format("{:016x}.{}", Hash, Name));
+
+        if (Entry.GetSize() < sizeof(CacheHeader))
+        {
+            return Data();
+        }
+
+        const UInt32 Length = Entry.GetSize() - sizeof(CacheHeader);
+
+        CacheHeader Header;
+        std::memcpy(& Header, Entry.GetData<UInt8>() + Length, sizeof(CacheHeader));
+
+        const CPtr<const UInt8> Payload(Entry.GetData<UInt8>(), Length);
+
+        if (Header.Magic != k_CacheMagic || Header.Hash != Hash || Header.Checksum != CRC32C(Payload))
+        {
+            Log::Warn("Resources: Discarding stale cache entry '{:016x}.{}'", Hash, Name);
+            return Data();
+        }
+
+        Entry.Truncate(Length);
+        return Entry;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool Service::SaveCache(CStr Name, UInt64 Hash, CPtr<const UInt8> Data)
+    {
+        std::shared_lock Guard(mRegistryMutex);
+
+        const auto It = mLocators.find(k_CacheSchema);
+
+        if (It == mLocators.end())
+        {
+            return false;
+        }
+
+        CacheHeader Header;
+        Header.Magic    = k_CacheMagic;
+        Header.Checksum = CRC32C(Data);
+        Header.Hash     = Hash;
+
+        Writer Entry(Data.size() + sizeof(CacheHeader));
+        Entry.Write<ConstPtr<UInt8>>(Data.data(), Data.size());
+        Entry.Write<ConstPtr<CacheHeader>>(& Header, sizeof(CacheHeader));
+
+        return It->second->Write(Format("{:016x}.{}", Hash, Name), Entry.GetData());
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    SPtr<Ticket> Service::SaveCacheAsync(CStr Name, UInt64 Hash, CPtr<const UInt8> Bytes)
+    {
+        std::shared_lock Guard(mRegistryMutex);
+
+        const auto It = mLocators.find(k_CacheSchema);
+
+        if (It == mLocators.end())
+        {
+            return nullptr;
+        }
+
+        CacheHeader Header;
+        Header.Magic    = k_CacheMagic;
+        Header.Checksum = CRC32C(Bytes);
+        Header.Hash     = Hash;
+
+        Data Entry(Bytes.size() + sizeof(CacheHeader));
+        std::memcpy(Entry.GetData<UInt8>(), Bytes.data(), Bytes.size());
+        std::memcpy(Entry.GetData<UInt8>() + Bytes.size(), & Header, sizeof(CacheHeader));
+
+        return It->second->Enqueue(Format("{:016x}.{}", Hash, Name), Move(Entry));
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool Service::Cook(ConstRef<Uri> Key)
+    {
+        if (const SPtr<Loader> Loader = FindLoader(Key.GetExtension()))
+        {
+            return Parse(Loader->Allocate(Key));
         }
         return false;
     }
@@ -138,6 +436,111 @@ namespace Content
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+    void Service::Evict()
+    {
+        Vector<SPtr<Resource>> Assets;
+
+        for (const Ptr<FactoryBase> Factory : FactoryBase::GetFactories())
+        {
+            for (Vector<SPtr<Resource>> Evicted = Factory->Evict(); Ref<SPtr<Resource>> Asset : Evicted)
+            {
+                Assets.emplace_back(Move(Asset));
+            }
+        }
+
+        for (ConstSPtr<Resource> Asset : Assets)
+        {
+            Process(Asset, false);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Service::Dispatch(UInt32 Count, ConstRef<FPtr<void(UInt32)>> Job)
+    {
+        struct Batch
+        {
+            FPtr<void(UInt32)> Job;
+            UInt32             Count;
+            Atomic<UInt32>     Next;
+            Atomic<UInt32>     Done;
+        };
+
+        if (Count == 0)
+        {
+            return;
+        }
+
+        // The state is shared with the helpers, which may only be picked up after the batch has finished.
+        const SPtr<Batch> State = NewPtr<Batch>(Job, Count, 0, 0);
+
+        const auto Work = [State]()
+        {
+            for (UInt32 Index = State->Next++; Index < State->Count; Index = State->Next++)
+            {
+                State->Job(Index);
+
+                if (++State->Done == State->Count)
+                {
+                    State->Done.notify_all();
+                }
+            }
+        };
+
+        if (const UInt32 Helpers = Min<UInt32>(Count, mWorkers.size() + 1) - 1; Helpers > 0)
+        {
+            {
+                std::lock_guard Guard(mPendingMutex);
+
+                for (UInt32 Index = 0; Index < Helpers; ++Index)
+                {
+                    mJobs.emplace_back(Work);
+                }
+            }
+            mPendingCondition.notify_all();
+        }
+
+        // Claim indices until none is left, then wait for the ones other threads are still running.
+        Work();
+
+        for (UInt32 Done = State->Done.load(); Done < Count; Done = State->Done.load())
+        {
+            State->Done.wait(Done);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Vector<SPtr<Resource>> Service::Collect(ConstSPtr<Resource> Asset) const
+    {
+        Vector<SPtr<Resource>> Collection;
+        Set<Ptr<Resource>>     Visited;
+
+        // Walk the graph depth-first, emitting every asset after its dependencies.
+        const auto Visit = [&](auto & Self, ConstSPtr<Resource> Node) -> void
+        {
+            if (Visited.emplace(Node.get()).second)
+            {
+                for (ConstSPtr<Resource> Dependency : Node->GetDependencies())
+                {
+                    Self(Self, Dependency);
+                }
+                Collection.emplace_back(Node);
+            }
+        };
+
+        for (ConstSPtr<Resource> Dependency : Asset->GetDependencies())
+        {
+            Visit(Visit, Dependency);
+        }
+        return Collection;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
     void Service::RegisterDefaultResources()
     {
         AddLocator("Engine://", NewPtr<MemoryLocator>());
@@ -152,10 +555,21 @@ namespace Content
             AddLoader(NewPtr<WAVLoader>());
 #endif // AE_CONTENT_LOADER_WAV
 
+#if defined(AE_CONTENT_LOADER_STB) || defined(AE_CONTENT_LOADER_KTX)
+            // Without a device (such as when cooking) every compressed family is produced as requested.
+            const ConstSPtr<Graphic::Service> Graphics = GetSubsystem<Graphic::Service>();
+            const Bool SupportsBC   = Graphics ? Graphics->GetCapabilities().BC   : true;
+            const Bool SupportsETC2 = Graphics ? Graphics->GetCapabilities().ETC2 : true;
+#endif // defined(AE_CONTENT_LOADER_STB) || defined(AE_CONTENT_LOADER_KTX)
+
 #ifdef    AE_CONTENT_LOADER_STB
-            AddLoader(NewPtr<STBLoader>());
+            AddLoader(NewPtr<STBLoader>(SupportsBC, SupportsETC2));
 #endif // AE_CONTENT_LOADER_STB
 
+#ifdef    AE_CONTENT_LOADER_KTX
+            AddLoader(NewPtr<KTXLoader>(SupportsBC, SupportsETC2));
+#endif // AE_CONTENT_LOADER_KTX
+
 #ifdef    AE_CONTENT_LOADER_EFFECT
             AddLoader(NewPtr<ShaderLoader>());
 #endif // AE_CONTENT_LOADER_EFFECT
@@ -165,7 +579,15 @@ namespace Content
             {
                 ConstRef<Graphic::Capabilities> GraphicCapabilities = Graphics->GetCapabilities();
                 AddLoader(NewPtr<PipelineLoader>(
-                    GraphicCapabilities.Backend, GraphicCapabilities.Language));
+                    GraphicCapabilities.Backend, GraphicCapabilities.Language, GraphicCapabilities.Identity));
+
+                // Let the driver persist the pipelines it links, so that warm starts skip compiling them.
+                Graphics->SetPipelineCache(Graphic::PipelineCache {
+                    [this](UInt64 Key, CPtr<const UInt8> Entry)
+                    {
+                        SaveCacheAsync("pipeline", Key, Entry);
+                    }
+                });
             }
 #endif // AE_CONTENT_LOADER_EFFECT
 
@@ -186,14 +608,26 @@ namespace Content
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+    SPtr<Loader> Service::FindLoader(CStr Extension)
+    {
+        std::shared_lock Guard(mRegistryMutex);
+
+        const auto Iterator = mLoaders.find(Extension);
+        return (Iterator != mLoaders.end() ? Iterator->second : nullptr);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
     Bool Service::Parse(ConstSPtr<Resource> Asset)
     {
         ConstRef<Uri> Key = Asset->GetKey();
 
-        if (const auto Iterator = mLoaders.find(Key.GetExtension()); Iterator != mLoaders.end())
-        {
-            ConstSPtr<Loader> Loader = Iterator->second;
+        // Dependencies are declared again by the loader.
+        Asset->ClearDependencies();
 
+        if (const SPtr<Loader> Loader = FindLoader(Key.GetExtension()))
+        {
             if (Data File = Find(Key); File.HasData())
             {
                 if (Loader->Load(* this, Move(File), * Asset))
@@ -213,4 +647,493 @@ namespace Content
         }
         return false;
     }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Service::Schedule(ConstSPtr<Resource> Asset, Bool Async)
+    {
+        if (Asset->TrySetStatus(Resource::Status::None, Resource::Status::Loading))
+        {
+            Submit(Asset, Async);
+        }
+        else if (! Async && Asset->IsLoading())
+        {
+            // The asset is being loaded in the background; if no thread has picked it up yet we steal it
+            // from the queue, otherwise we wait until it has been parsed.
+            Bool Stolen = false;
+            {
+                std::unique_lock Lock(mPendingMutex);
+
+                if (const auto Iterator = std::find(mPending.begin(), mPending.end(), Asset); Iterator != mPending.end())
+                {
+                    mPending.erase(Iterator);
+                    mParsing.emplace(Asset.get());
+                    Stolen = true;
+                }
+                else if (s_Worker)
+                {
+                    // Workers cannot finalize assets, but a parsed asset is all a loader needs to read from.
+                    mParsedCondition.wait(Lock, [&] { return ! mParsing.contains(Asset.get()); });
+                }
+            }
+
+            if (s_Worker)
+            {
+                if (Stolen)
+                {
+                    Complete(Asset, Consume(Asset));
+                }
+            }
+            else
+            {
+                if (Stolen)
+                {
+                    Resolve(Asset, Consume(Asset));
+                }
+
+                while (Asset->IsLoading())
+                {
+                    Progress();
+                }
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Service::Reschedule(ConstSPtr<Resource> Asset, Bool Async)
+    {
+        // Assets still loading pick up the changes already, since they have not been parsed yet or are about to be
+        // reloaded by whoever claimed them.
+        const Resource::Status Status = Asset->GetStatus();
+
+        if (Status != Resource::Status::Loaded && Status != Resource::Status::Failed)
+        {
+            return;
+        }
+
+        if (Asset->TrySetStatus(Status, Resource::Status::Loading))
+        {
+            Submit(Asset, Async);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Service::Submit(ConstSPtr<Resource> Asset, Bool Async)
+    {
+        if (Async)
+        {
+            {
+                std::lock_guard Guard(mPendingMutex);
+                mPending.emplace_back(Asset);
+            }
+            mPendingCondition.notify_one();
+        }
+        else
+        {
+            {
+                std::lock_guard Guard(mPendingMutex);
+                mParsing.emplace(Asset.get());
+            }
+
+            if (s_Worker)
+            {
+                // Nested requests issued by a loader run inline, but the creation is deferred to the main
+                // thread since resources may only be created there.
+                Complete(Asset, Consume(Asset));
+            }
+            else
+            {
+                Resolve(Asset, Consume(Asset));
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool Service::Consume(ConstSPtr<Resource> Asset)
+    {
+        const Bool Result = Parse(Asset);
+
+        // Release every thread waiting for the asset to be parsed.
+        {
+            std::lock_guard Guard(mPendingMutex);
+            mParsing.erase(Asset.get());
+        }
+        mParsedCondition.notify_all();
+
+        return Result;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Service::Resolve(ConstSPtr<Resource> Asset, Bool Successful)
+    {
+        // Dependencies declared while parsing are loaded in parallel by the worker pool; wait for all of them
+        // before creating the asset, finalizing anything else that completes in the meantime.
+        while (Asset->HasPendingDependencies())
+        {
+            Progress();
+        }
+        Finalize(Asset, Successful);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Service::Progress()
+    {
+        if (! Finalize())
+        {
+            std::unique_lock Lock(mCompletedMutex);
+            mCompletedCondition.wait(Lock, [this] { return ! mCompleted.empty(); });
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Service::Subscribe(ConstSPtr<Resource> Asset, Any<Callback> Callback)
+    {
+        if (Asset->HasFinished())
+        {
+            Callback(Asset);
+        }
+        else
+        {
+            std::lock_guard Guard(mCompletedMutex);
+            mCallbacks[Asset.get()].emplace_back(Move(Callback));
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Service::Complete(ConstSPtr<Resource> Asset, Bool Successful)
+    {
+        {
+            std::lock_guard Guard(mCompletedMutex);
+            mCompleted.emplace_back(Completion { Asset, Successful });
+        }
+        mCompletedCondition.notify_all();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Service::Finalize(ConstSPtr<Resource> Asset, Bool Successful)
+    {
+        if (Successful)
+        {
+            Process(Asset, true);
+        }
+        else
+        {
+            Asset->SetStatus(Resource::Status::Failed);
+        }
+
+        Vector<Callback> Callbacks;
+        {
+            std::lock_guard Guard(mCompletedMutex);
+
+            if (const auto Iterator = mCallbacks.find(Asset.get()); Iterator != mCallbacks.end())
+            {
+                Callbacks = Move(Iterator->second);
+                mCallbacks.erase(Iterator);
+            }
+        }
+
+        for (ConstRef<Callback> Callback : Callbacks)
+        {
+            Callback(Asset);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool Service::Finalize()
+    {
+        // Assets whose dependencies were still loading when they completed take priority, as soon as
+        // every one of their dependencies has finished.
+        for (auto Iterator = mDeferred.begin(); Iterator != mDeferred.end(); ++Iterator)
+        {
+            if (! Iterator->Asset->HasPendingDependencies())
+            {
+                const Completion Entry = Move(* Iterator);
+                mDeferred.erase(Iterator);
+
+                Finalize(Entry.Asset, Entry.Successful);
+                return true;
+            }
+        }
+
+        while (true)
+        {
+            Completion Entry;
+            {
+                std::lock_guard Guard(mCompletedMutex);
+
+                if (mCompleted.empty())
+                {
+                    return false;
+                }
+
+                Entry = Move(mCompleted.front());
+                mCompleted.pop_front();
+            }
+
+            if (Entry.Asset->HasPendingDependencies())
+            {
+                mDeferred.emplace_back(Move(Entry));
+            }
+            else
+            {
+                Finalize(Entry.Asset, Entry.Successful);
+                return true;
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Service::Watch(Real64 Time)
+    {
+        Vector<SStr> Changes;
+
+        {
+            std::shared_lock Guard(mRegistryMutex);
+
+            for (const auto & [_, Locator] : mLocators)
+            {
+                Locator->Poll(Changes);
+            }
+        }
+
+        if (! Changes.empty())
+        {
+            ClearMissing();
+        }
+
+        for (Ref<SStr> Path : Changes)
+        {
+            mChanges[Move(Path)] = Time;
+        }
+
+        // Only reload files that have settled, coalescing the events produced by a single save.
+        Vector<SStr> Paths;
+
+        for (auto Iterator = mChanges.begin(); Iterator != mChanges.end();)
+        {
+            if (Time - Iterator->second >= k_ReloadDelay)
+            {
+                Paths.emplace_back(Iterator->first);
+                Iterator = mChanges.erase(Iterator);
+            }
+            else
+            {
+                ++Iterator;
+            }
+        }
+
+        if (! Paths.empty())
+        {
+            Refresh(Paths);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Service::Refresh(ConstRef<Vector<SStr>> Paths)
+    {
+        Vector<SPtr<Resource>> Changed;
+        Vector<SPtr<Resource>> Assets;
+
+        for (const Ptr<FactoryBase> Factory : FactoryBase::GetFactories())
+        {
+            for (ConstRef<SStr> Path : Paths)
+            {
+                Factory->Find(AssetId(Path), Changed);
+            }
+            Factory->Collect(Assets);
+        }
+
+        // Assets built from any of the changed files besides their own have changed as well.
+        for (ConstSPtr<Resource> Asset : Assets)
+        {
+            const Bool Affected = std::any_of(Paths.begin(), Paths.end(), [&Asset](ConstRef<SStr> Path)
+            {
+                return Asset->HasFile(AssetId(Path));
+            });
+
+            if (Affected)
+            {
+                Changed.emplace_back(Asset);
+            }
+        }
+
+        std::erase_if(Changed, [](ConstSPtr<Resource> Asset)
+        {
+            return ! Asset->HasFinished();
+        });
+
+        if (Changed.empty())
+        {
+            return;
+        }
+
+        // Invert the dependency graph, to find every asset built on top of the ones that have changed.
+        Table<Ptr<Resource>, Vector<SPtr<Resource>>> Dependents;
+
+        for (ConstSPtr<Resource> Asset : Assets)
+        {
+            if (Asset->HasFinished())
+            {
+                for (ConstSPtr<Resource> Dependency : Asset->GetDependencies())
+                {
+                    Dependents[Dependency.get()].emplace_back(Asset);
+                }
+            }
+        }
+
+        Set<Ptr<Resource>>     Affected;
+        Vector<SPtr<Resource>> Pending(Changed);
+
+        while (! Pending.empty())
+        {
+            const SPtr<Resource> Asset = Move(Pending.back());
+            Pending.pop_back();
+
+            if (Affected.emplace(Asset.get()).second)
+            {
+                if (const auto Iterator = Dependents.find(Asset.get()); Iterator != Dependents.end())
+                {
+                    Pending.insert(Pending.end(), Iterator->second.begin(), Iterator->second.end());
+                }
+            }
+        }
+
+        // Rebuild the affected assets in dependency order, so each one observes its dependencies already reloaded.
+        Set<Ptr<Resource>>     Visited;
+        Vector<SPtr<Resource>> Order;
+
+        const auto Visit = [&](auto & Self, ConstSPtr<Resource> Node) -> void
+        {
+            if (Affected.contains(Node.get()) && Visited.emplace(Node.get()).second)
+            {
+                for (ConstSPtr<Resource> Dependency : Node->GetDependencies())
+                {
+                    Self(Self, Dependency);
+                }
+                Order.emplace_back(Node);
+            }
+        };
+
+        for (ConstSPtr<Resource> Asset : Assets)
+        {
+            Visit(Visit, Asset);
+        }
+
+        // Claiming them in that order marks every dependency as 'Loading' before its dependents are parsed, hence
+        // a dependent waits for its dependencies to be parsed again, and is not created before they are.
+        for (ConstSPtr<Resource> Asset : Order)
+        {
+            Log::Info("Resources: Reloading '{}'", Asset->GetKey().GetUrl());
+
+            Reload(Asset, true);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool Service::IsMissing(UInt64 Hash)
+    {
+        std::lock_guard Guard(mMissingMutex);
+        return mMissing.contains(Hash);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Service::SetMissing(UInt64 Hash)
+    {
+        std::lock_guard Guard(mMissingMutex);
+
+        if (! mMissing.emplace(Hash).second)
+        {
+            return;
+        }
+        mMissingOrder.emplace_back(Hash);
+
+        if (mMissingOrder.size() > k_MissingCapacity)
+        {
+            mMissing.erase(mMissingOrder.front());
+            mMissingOrder.pop_front();
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Service::ClearMissing()
+    {
+        std::lock_guard Guard(mMissingMutex);
+
+        mMissing.clear();
+        mMissingOrder.clear();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Service::OnWork(std::stop_token Token)
+    {
+        s_Worker = true;
+
+        while (! Token.stop_requested())
+        {
+            SPtr<Resource> Asset;
+            FPtr<void()>   Job;
+            {
+                std::unique_lock Lock(mPendingMutex);
+
+                // Sleep until an asset is requested, a job is dispatched or a stop request has been issued.
+                if (! mPendingCondition.wait(Lock, Token, [this] { return ! mPending.empty() || ! mJobs.empty(); }))
+                {
+                    break;
+                }
+
+                // Jobs take priority, since the thread that dispatched them is waiting on them.
+                if (! mJobs.empty())
+                {
+                    Job = Move(mJobs.front());
+                    mJobs.pop_front();
+                }
+                else
+                {
+                    Asset = Move(mPending.front());
+                    mPending.pop_front();
+                    mParsing.emplace(Asset.get());
+                }
+            }
+
+            if (Job)
+            {
+                Job();
+            }
+            else
+            {
+                Complete(Asset, Consume(Asset));
+            }
+        }
+    }
 }
\ No newline at end of file
@@ -15,6 +15,10 @@
 #include "Factory.hpp"
 #include "Loader.hpp"
 #include "Locator.hpp"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 // [   CODE   ]
@@ -23,13 +27,51 @@
 namespace Content
 {
     // -=(Undocumented)=-
-    class Service final : public AbstractSubsystem<Service>
+    class Service final : public AbstractSubsystem<Service>, public Tickable
     {
+    public:
+
+        // -=(Undocumented)=-
+        static constexpr CStr k_CacheSchema = "Cache://";
+
+        // -=(Undocumented)=-
+        static constexpr Real64 k_DefaultFinalizeBudget = 0.002;
+
+        // Time (in seconds) a changed file must remain untouched before it is reloaded, so that bursts
+        // of events produced by a single save are coalesced.
+        static constexpr Real64 k_ReloadDelay = 0.1;
+
+        // Maximum number of unresolved uris remembered, so that requesting a missing asset again does not
+        // query every locator; the oldest entries are forgotten first.
+        static constexpr UInt   k_MissingCapacity = 1024;
+
+        // -=(Undocumented)=-
+        using Callback = FPtr<void(ConstSPtr<Resource>)>;
+
     public:
 
         // -=(Undocumented)=-
         explicit Service(Ref<Context> Context);
 
+        // \see Subsystem::OnDispose
+        void OnDispose() override;
+
+        // \see Tickable::OnTick
+        void OnTick(ConstRef<Time> Time) override;
+
+        // Sets the maximum amount of time (in seconds) spent on each tick finalizing assets
+        // that have been loaded in the background.
+        void SetFinalizeBudget(Real64 Budget)
+        {
+            mBudget = Budget;
+        }
+
+        // -=(Undocumented)=-
+        Real64 GetFinalizeBudget() const
+        {
+            return mBudget;
+        }
+
         // -=(Undocumented)=-
         void AddLoader(ConstSPtr<Loader> Loader);
 
@@ -45,12 +87,19 @@ namespace Content
             }
         }
 
+        // -=(Undocumented)=-
+        Bool HasLoader(CStr Extension) const;
+
         // -=(Undocumented)=-
         void AddLocator(CStr Schema, ConstSPtr<Locator> Locator);
 
         // -=(Undocumented)=-
         void RemoveLocator(CStr Schema);
 
+        // Discards the index of every locator along with the uris known to be missing, meant to be called
+        // after the content has been changed by other means than the service.
+        void Rescan();
+
         // -=(Undocumented)=-
         template<typename Type>
         void SetMemoryBudget(UInt Budget)
@@ -75,6 +124,15 @@ namespace Content
         // -=(Undocumented)=-
         Data Find(ConstRef<Uri> Key);
 
+        // Reads a file the asset is built from, meant to be called by loaders; the file is tracked even if it does not
+        // exist, so that the asset is reloaded whenever it is created, changed or deleted.
+        Data Read(Ref<Resource> Owner, ConstRef<Uri> Key)
+        {
+            Owner.AddFile(AssetId(Key.GetPathWithoutFragment()));
+
+            return Find(Key);
+        }
+
         // -=(Undocumented)=-
         Bool Save(ConstRef<Uri> Key, CStr Data)
         {
@@ -86,46 +144,97 @@ namespace Content
         // -=(Undocumented)=-
         Bool Save(ConstRef<Uri> Key, CPtr<const UInt8> Data);
 
+        // Hands the data off to the locator without waiting for it to be written, returns the ticket to poll or wait
+        // on, or null if no locator handles the uri's schema.
+        SPtr<Ticket> SaveAsync(ConstRef<Uri> Key, Any<Data> Bytes);
+
         // -=(Undocumented)=-
         Bool Delete(ConstRef<Uri> Key);
 
         // -=(Undocumented)=-
+        Data FindCache(CStr Name, UInt64 Hash);
+
+        // -=(Undocumented)=-
+        Bool SaveCache(CStr Name, UInt64 Hash, CPtr<const UInt8> Data);
+
+        // Same as \see SaveCache, but hands the entry off to the cache's locator without waiting for it to be written.
+        SPtr<Ticket> SaveCacheAsync(CStr Name, UInt64 Hash, CPtr<const UInt8> Bytes);
+
+        // Parses the asset without creating it nor registering it, so that loaders store its decoded form
+        // in the cache ahead of time; returns false if no loader handles it or if it fails to parse.
+        Bool Cook(ConstRef<Uri> Key);
+
+        // Loads the asset if it has not been requested before. Asynchronous requests are parsed by
+        // the worker pool and created on the main thread during \see OnTick; poll \see Resource::GetStatus
+        // to know when the asset is ready.
         template<typename Type>
         SPtr<Type> Load(ConstRef<Uri> Key, Bool Async = false)
         {
-            ConstSPtr<Type> Asset = Type::GetFactory().GetOrCreate(Key, true);
+            ConstSPtr<Type> Asset = Fetch<Type>(Key, true);
+
+            if (Asset)
+            {
+                Schedule(Asset, Async);
+            }
+            return Asset;
+        }
+
+        // Loads the asset asynchronously and invokes the callback on the main thread once it has
+        // finished, either successfully or not.
+        template<typename Type, typename Function>
+            requires std::is_invocable_v<Function, ConstSPtr<Type>>
+        SPtr<Type> Load(ConstRef<Uri> Key, Any<Function> Callback)
+        {
+            ConstSPtr<Type> Asset = Fetch<Type>(Key, true);
 
-            if (Asset && !Asset->HasFinished())
+            if (Asset)
             {
-                // TODO: Asynchronous
-                if (const Bool Found = Parse(Asset))
+                Subscribe(Asset, [Callback = std::forward<Function>(Callback)](ConstSPtr<Resource> Resource)
                 {
-                    Process(Asset, true);
-                }
-                else
+                    Callback(std::static_pointer_cast<Type>(Resource));
+                });
+                Schedule(Asset, true);
+            }
+            return Asset;
+        }
+
+        // Declares a dependency of the asset being loaded, meant to be called by loaders. Asynchronous dependencies
+        // are loaded in parallel with their siblings, and the owner is not created until all of them have finished.
+        template<typename Type>
+        SPtr<Type> Require(Ref<Resource> Owner, ConstRef<Uri> Key, Bool Async = true)
+        {
+            ConstSPtr<Type> Asset = Fetch<Type>(Key, true);
+
+            if (Asset)
+            {
+                // A cycle would keep both assets alive and waiting on each other forever.
+                if (! Owner.AddDependency(Asset))
                 {
-                    Asset->SetStatus(Resource::Status::Failed);
+                    Log::Warn("Resources: Rejecting cyclic dependency from '{}' to '{}'", Owner.GetKey().GetUrl(), Key.GetUrl());
+                    return nullptr;
                 }
+                Schedule(Asset, Async);
             }
-
             return Asset;
         }
 
-        // -=(Undocumented)=-
+        // Runs the job once for every index in [0, Count) on the worker pool, the calling thread taking part as well, and
+        // returns once all of them have finished. The caller never waits on a job nobody has started, so loaders may call
+        // it from a worker without oversubscribing the cores.
+        void Dispatch(UInt32 Count, ConstRef<FPtr<void(UInt32)>> Job);
+
+        // Returns every asset the given asset depends on, directly or indirectly, each one after its own dependencies.
+        Vector<SPtr<Resource>> Collect(ConstSPtr<Resource> Asset) const;
+
+        // Parses a finished asset again and recreates it once every dependency it declares has finished, exactly
+        // like \see Load does. The asset is 'Loading' meanwhile (so that dependents wait on it) while its previous
+        // instance stays in use until it is replaced.
         template<typename Type>
         void Reload(ConstSPtr<Type> Asset, Bool Async = false)
         {
-            if (Asset && Asset->HasFinished())
+            if (Asset)
             {
-                // TODO: Asynchronous
-                if (const Bool Found = Parse(Asset))
-                {
-                    Process(Asset, true);
-                }
-                else
-                {
-                    Asset->SetStatus(Resource::Status::Failed);
-                }
+                Reschedule(Asset, Async);
             }
         }
 
@@ -133,7 +242,7 @@ namespace Content
         template<typename Type>
         Bool Exist(ConstRef<Uri> Key)
         {
-            return (Type::GetFactory().GetOrCreate(Key, false) != nullptr);
+            return (Fetch<Type>(Key, false) != nullptr);
         }
 
         // -=(Undocumented)=-
@@ -142,8 +251,6 @@ namespace Content
         {
             if (Asset && Type::GetFactory().Remove(Asset->GetKey()))
             {
-                // TODO: Asynchronous
-
                 Process(Asset, false);
             }
         }
@@ -152,12 +259,16 @@ namespace Content
         template<typename Type>
         void Prune(Bool Force)
         {
-            for (const Vector<SPtr<Type>> Assets = Type::GetFactory().Prune(Force); ConstSPtr<Type> Asset : Assets)
+            for (ConstSPtr<Type> Asset : Type::GetFactory().Prune(Force))
             {
                 Process(Asset, false);
             }
         }
 
+        // Deletes the least recently used assets that are no longer referenced from every factory whose
+        // memory usage exceeds its budget. Called automatically on every tick.
+        void Evict();
+
         // -=(Undocumented)=-
         template<typename Type>
         void Process(ConstSPtr<Type> Asset, Bool Loaded)
@@ -181,15 +292,104 @@ namespace Content
         // -=(Undocumented)=-
         void RegisterDefaultResources();
 
+        // Returns the loader registered for the extension, or null when none handles it.
+        SPtr<Loader> FindLoader(CStr Extension);
+
         // -=(Undocumented)=-
         Bool Parse(ConstSPtr<Resource> Asset);
 
+        // -=(Undocumented)=-
+        template<typename Type>
+        SPtr<Type> Fetch(ConstRef<Uri> Key, Bool CreateIfNeeded)
+        {
+            return Type::GetFactory().GetOrCreate(Key, CreateIfNeeded);
+        }
+
+        // -=(Undocumented)=-
+        void Schedule(ConstSPtr<Resource> Asset, Bool Async);
+
+        // Claims a finished asset for loading it again, see \see Reload.
+        void Reschedule(ConstSPtr<Resource> Asset, Bool Async);
+
+        // Parses an asset claimed by the calling thread, on the worker pool when asynchronous or inline otherwise.
+        void Submit(ConstSPtr<Resource> Asset, Bool Async);
+
+        // Parses an asset claimed by the calling thread, waking up the threads waiting for it.
+        Bool Consume(ConstSPtr<Resource> Asset);
+
+        // -=(Undocumented)=-
+        void Subscribe(ConstSPtr<Resource> Asset, Any<Callback> Callback);
+
+        // -=(Undocumented)=-
+        void Complete(ConstSPtr<Resource> Asset, Bool Successful);
+
+        // -=(Undocumented)=-
+        void Resolve(ConstSPtr<Resource> Asset, Bool Successful);
+
+        // -=(Undocumented)=-
+        void Progress();
+
+        // -=(Undocumented)=-
+        void Finalize(ConstSPtr<Resource> Asset, Bool Successful);
+
+        // -=(Undocumented)=-
+        Bool Finalize();
+
+        // -=(Undocumented)=-
+        void Watch(Real64 Time);
+
+        // -=(Undocumented)=-
+        void Refresh(ConstRef<Vector<SStr>> Paths);
+
+        // -=(Undocumented)=-
+        Bool IsMissing(UInt64 Hash);
+
+        // -=(Undocumented)=-
+        void SetMissing(UInt64 Hash);
+
+        // -=(Undocumented)=-
+        void ClearMissing();
+
+        // -=(Undocumented)=-
+        void OnWork(std::stop_token Token);
+
+    private:
+
+        // -=(Undocumented)=-
+        struct Completion
+        {
+            SPtr<Resource> Asset;
+            Bool           Successful;
+        };
+
     private:
 
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-        StringTable<SPtr<Loader>>  mLoaders;
-        StringTable<SPtr<Locator>> mLocators;
+        mutable std::shared_mutex               mRegistryMutex;
+        StringTable<SPtr<Loader>>               mLoaders;
+        StringTable<SPtr<Locator>>              mLocators;
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Vector<Thread>                          mWorkers;
+        std::mutex                              mPendingMutex;
+        std::condition_variable_any             mPendingCondition;
+        std::deque<SPtr<Resource>>              mPending;
+        std::deque<FPtr<void()>>                mJobs;
+        Set<Ptr<Resource>>                      mParsing;
+        std::condition_variable                 mParsedCondition;
+        std::mutex                              mCompletedMutex;
+        std::condition_variable                 mCompletedCondition;
+        std::deque<Completion>                  mCompleted;
+        Vector<Completion>                      mDeferred;
+        Table<Ptr<Resource>, Vector<Callback>>  mCallbacks;
+        Real64                                  mBudget;
+        StringTable<Real64>                     mChanges;
+        std::mutex                              mMissingMutex;
+        Set<UInt64>                             mMissing;
+        std::deque<UInt64>                      mMissingOrder;
     };
 }
\ No newline at end of file
@@ -10,4 +10,34 @@
 // [  HEADER  ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-#include "Uri.hpp"
\ No newline at end of file
+#include "Uri.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Content
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Uri::Parse()
+    {
+        const CStr Url = GetUrl();
+
+        // 'schema://folder/filename.extension#fragment', where every component but the filename is optional.
+        const UInt Schema = Url.find("://");
+        mPath = (Schema != CStr::npos ? Schema + 3 : 0);
+
+        const UInt Fragment = Url.find('#', mPath);
+        mFragment = (Fragment != CStr::npos ? Fragment : Url.size());
+
+        const UInt Separator = Url.substr(0, mFragment).rfind('/');
+        mFilename = (Separator != CStr::npos && Separator >= mPath ? Separator + 1 : mPath);
+
+        const UInt Extension = Url.substr(0, mFragment).rfind('.');
+        mExtension = (Extension != CStr::npos && Extension >= mFilename ? Extension + 1 : mFragment);
+
+        mId = AssetId(GetPathWithoutFragment(), GetFragment());
+    }
+}
\ No newline at end of file
@@ -20,6 +20,45 @@
 
 namespace Content
 {
+    // Compact identity of an asset, the hash of its path along with the hash of its fragment; the schema is not part
+    // of it, so that an asset found through different locators is the same asset, and the fragment is kept apart, so
+    // that every asset loaded from the same file can be found from the file's path alone.
+    struct AssetId final
+    {
+        // -=(Undocumented)=-
+        UInt64 Hash     = 0;
+
+        // -=(Undocumented)=-
+        UInt64 Fragment = 0;
+
+        // -=(Undocumented)=-
+        AssetId() = default;
+
+        // -=(Undocumented)=-
+        explicit AssetId(CStr Path, CStr Fragment = "")
+            : Hash     { Digest(Path) },
+              Fragment { Fragment.empty() ? 0 : Digest(Fragment) }
+        {
+        }
+
+        // Whether both ids refer to the same file, regardless of their fragment.
+        Bool IsSameFile(ConstRef<AssetId> Other) const
+        {
+            return Hash == Other.Hash;
+        }
+
+        // -=(Undocumented)=-
+        Bool operator==(ConstRef<AssetId> Other) const = default;
+
+    private:
+
+        // -=(Undocumented)=-
+        static UInt64 Digest(CStr Text)
+        {
+            return XXHash64(CPtr<const UInt8>(reinterpret_cast<ConstPtr<UInt8>>(Text.data()), Text.size()));
+        }
+    };
+
     // -=(Undocumented)=-
     class Uri final
     {
@@ -32,36 +71,51 @@ namespace Content
         Uri(ConstPtr<Char> Url)
             : mUrl { Url }
         {
+            Parse();
         }
 
         // -=(Undocumented)=-
         Uri(ConstRef<SStr> Url)
             : mUrl { Url }
         {
+            Parse();
         }
 
         // -=(Undocumented)=-
         Uri(CStr Url)
             : mUrl { Url }
         {
+            Parse();
         }
 
         // -=(Undocumented)=-
         Bool HasSchema() const
         {
-            return !GetSchema().empty();
+            return mPath > 0;
         }
 
         // -=(Undocumented)=-
         Bool HasFolder() const
         {
-            return !GetFolder().empty();
+            return mFilename > mPath;
         }
 
         // -=(Undocumented)=-
         Bool HasExtension() const
         {
-            return !GetExtension().empty();
+            return mExtension < mFragment;
+        }
+
+        // -=(Undocumented)=-
+        Bool HasFragment() const
+        {
+            return mFragment < mUrl.size();
+        }
+
+        // -=(Undocumented)=-
+        AssetId GetId() const
+        {
+            return mId;
         }
 
         // -=(Undocumented)=-
@@ -73,44 +127,55 @@ namespace Content
         // -=(Undocumented)=-
         CStr GetUrlWithoutExtension() const
         {
-            const UInt Offset = mUrl.rfind('.');
-            return (Offset != CStr::npos ? GetUrl().substr(0, Offset) : GetUrl());
+            return HasExtension() ? GetUrl().substr(0, mExtension - 1) : GetUrl();
+        }
+
+        // Returns the url of the file that holds the asset, without the fragment.
+        CStr GetUrlWithoutFragment() const
+        {
+            return GetUrl().substr(0, mFragment);
         }
 
         // -=(Undocumented)=-
         CStr GetSchema() const
         {
-            const UInt Offset = mUrl.find("://");
-            return (Offset != CStr::npos ? GetUrl().substr(0, Offset) : "");
+            return HasSchema() ? GetUrl().substr(0, mPath - 3) : "";
         }
 
-        // -=(Undocumented)=-
+        // Returns everything after the schema, including the fragment.
         CStr GetPath() const
         {
-            const UInt Offset = mUrl.find("://");
-            return (Offset != CStr::npos ? GetUrl().substr(Offset + 3, mUrl.length()) : mUrl);
+            return GetUrl().substr(mPath);
         }
 
         // -=(Undocumented)=-
+        CStr GetPathWithoutFragment() const
+        {
+            return GetUrl().substr(mPath, mFragment - mPath);
+        }
+
+        // Returns the folder that contains the file, without the trailing separator.
         CStr GetFolder() const
         {
-            const CStr Path   = GetPath();
-            const UInt Offset = mUrl.find('/');
-            return (Offset != CStr::npos ? Path.substr(0, Offset) : "");
+            return HasFolder() ? GetUrl().substr(mPath, mFilename - mPath - 1) : "";
         }
 
         // -=(Undocumented)=-
         CStr GetFilename() const
         {
-            const UInt Offset = mUrl.rfind('/');
-            return (Offset != CStr::npos ? GetUrl().substr(Offset + 1, mUrl.length()) : GetPath());
+            return GetUrl().substr(mFilename);
         }
 
         // -=(Undocumented)=-
         CStr GetExtension() const
         {
-            const UInt Offset = mUrl.rfind('.');
-            return (Offset != CStr::npos ? GetUrl().substr(Offset + 1, mUrl.length()) : "");
+            return GetUrl().substr(mExtension, mFragment - mExtension);
+        }
+
+        // -=(Undocumented)=-
+        CStr GetFragment() const
+        {
+            return HasFragment() ? GetUrl().substr(mFragment + 1) : "";
         }
 
     public:
@@ -121,11 +186,33 @@ namespace Content
             return Uri(Format("{}#{}", Parent.GetUrlWithoutExtension(), Subresource));
         }
 
+    private:
+
+        // Finds the offset of every component once, so they can be accessed without searching the url.
+        void Parse();
+
     private:
 
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
         const SStr mUrl;
+        UInt32     mPath      = 0;
+        UInt32     mFilename  = 0;
+        UInt32     mExtension = 0;
+        UInt32     mFragment  = 0;
+        AssetId    mId;
     };
-}
\ No newline at end of file
+}
+
+// -=(Undocumented)=-
+template<>
+struct ankerl::unordered_dense::hash<Content::AssetId>
+{
+    using is_avalanching = void;
+
+    [[nodiscard]] UInt64 operator()(ConstRef<Content::AssetId> Value) const
+    {
+        return Value.Hash ^ (Value.Fragment * 0x9E3779B97F4A7C15ull);
+    }
+};
\ No newline at end of file
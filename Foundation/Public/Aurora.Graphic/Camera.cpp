@@ -111,4 +111,21 @@ namespace Graphic
 
         return Vector2f(Coordinates.GetX(), Coordinates.GetY());
     }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Real32 Camera::GetScreenSize(ConstRef<Vector3f> Position, Real32 Extent, ConstRef<Rectf> Viewport) const
+    {
+        const Real32 Size = Extent * mProjection.GetComponent(5) * Viewport.GetHeight() * 0.5f;
+
+        // An orthographic projection keeps the size regardless of the distance.
+        if (mProjection.GetComponent(15) != 0.0f)
+        {
+            return Size;
+        }
+
+        const Real32 Depth = (mView * Position).GetZ();
+        return (Depth > k_Epsilon<Real32> ? Size / Depth : std::numeric_limits<Real32>::max());
+    }
 }
\ No newline at end of file
@@ -331,6 +331,9 @@ namespace Graphic
         // -=(Undocumented)=-
         Vector2f GetScreenCoordinates(ConstRef<Vector2f> Position, ConstRef<Rectf> Viewport) const;
 
+        // Returns how many pixels of the viewport's height an extent at the given world position covers.
+        Real32 GetScreenSize(ConstRef<Vector3f> Position, Real32 Extent, ConstRef<Rectf> Viewport) const;
+
     private:
 
         static constexpr UInt32 k_DirtyBitTransformation = 1 << 0;
@@ -10,4 +10,121 @@
 // [  HEADER  ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-#include "Common.hpp"
\ No newline at end of file
+#include "Common.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Graphic
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    // Size (in bytes) of a texel, or of a 4x4 block for compressed formats.
+    static constexpr UInt8 k_TextureBytes[] = {
+        8,      // TextureFormat::BC1UIntNorm
+        8,      // TextureFormat::BC1UIntNorm_sRGB
+        16,     // TextureFormat::BC2UIntNorm
+        16,     // TextureFormat::BC2UIntNorm_sRGB
+        16,     // TextureFormat::BC3UIntNorm
+        16,     // TextureFormat::BC3UIntNorm_sRGB
+        8,      // TextureFormat::BC4UIntNorm
+        16,     // TextureFormat::BC5UIntNorm
+        16,     // TextureFormat::BC7UIntNorm
+        16,     // TextureFormat::BC7UIntNorm_sRGB
+        8,      // TextureFormat::ETC2RGB8UIntNorm
+        8,      // TextureFormat::ETC2RGB8UIntNorm_sRGB
+        16,     // TextureFormat::ETC2RGBA8UIntNorm
+        16,     // TextureFormat::ETC2RGBA8UIntNorm_sRGB
+        1,      // TextureFormat::R8SInt
+        1,      // TextureFormat::R8SIntNorm
+        1,      // TextureFormat::R8UInt
+        1,      // TextureFormat::R8UIntNorm
+        2,      // TextureFormat::R16SInt
+        2,      // TextureFormat::R16SIntNorm
+        2,      // TextureFormat::R16UInt
+        2,      // TextureFormat::R16UIntNorm
+        2,      // TextureFormat::R16Float
+        4,      // TextureFormat::R32SInt
+        4,      // TextureFormat::R32UInt
+        4,      // TextureFormat::R32Float
+        2,      // TextureFormat::RG8SInt
+        2,      // TextureFormat::RG8SIntNorm
+        2,      // TextureFormat::RG8UInt
+        2,      // TextureFormat::RG8UIntNorm
+        4,      // TextureFormat::RG16SInt
+        4,      // TextureFormat::RG16SIntNorm
+        4,      // TextureFormat::RG16UInt
+        4,      // TextureFormat::RG16UIntNorm
+        4,      // TextureFormat::RG16Float
+        8,      // TextureFormat::RG32SInt
+        8,      // TextureFormat::RG32UInt
+        8,      // TextureFormat::RG32Float
+        12,     // TextureFormat::RGB32SInt
+        12,     // TextureFormat::RGB32UInt
+        12,     // TextureFormat::RGB32Float
+        4,      // TextureFormat::RGBA8SInt
+        4,      // TextureFormat::RGBA8SIntNorm
+        4,      // TextureFormat::RGBA8UInt
+        4,      // TextureFormat::RGBA8UIntNorm
+        4,      // TextureFormat::RGBA8UIntNorm_sRGB
+        4,      // TextureFormat::BGRA8UIntNorm
+        4,      // TextureFormat::BGRA8UIntNorm_sRGB
+        8,      // TextureFormat::RGBA16SInt
+        8,      // TextureFormat::RGBA16SIntNorm
+        8,      // TextureFormat::RGBA16UInt
+        8,      // TextureFormat::RGBA16UIntNorm
+        8,      // TextureFormat::RGBA16Float
+        16,     // TextureFormat::RGBA32SInt
+        16,     // TextureFormat::RGBA32UInt
+        16,     // TextureFormat::RGBA32Float
+        4,      // TextureFormat::D32Float
+        2,      // TextureFormat::D16X0UIntNorm
+        4,      // TextureFormat::D24S8UIntNorm
+        8,      // TextureFormat::D32S8UIntNorm
+    };
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool IsCompressed(TextureFormat Format)
+    {
+        // Compressed formats are declared first.
+        return Format <= TextureFormat::ETC2RGBA8UIntNorm_sRGB;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt32 GetTexturePitch(TextureFormat Format, UInt16 Width)
+    {
+        const UInt32 Blocks = IsCompressed(Format) ? (Width + 3u) / 4u : Width;
+        return Blocks * k_TextureBytes[CastEnum(Format)];
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt32 GetTextureSize(TextureFormat Format, UInt16 Width, UInt16 Height)
+    {
+        const UInt32 Rows = IsCompressed(Format) ? (Height + 3u) / 4u : Height;
+        return Rows * GetTexturePitch(Format, Width);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt32 GetTextureSize(TextureFormat Format, UInt16 Width, UInt16 Height, UInt8 Levels)
+    {
+        UInt32 Size = 0;
+
+        for (UInt8 Level = 0; Level < Levels; ++Level)
+        {
+            Size  += GetTextureSize(Format, Width, Height);
+            Width  = Max<UInt16>(1, Width  >> 1);
+            Height = Max<UInt16>(1, Height >> 1);
+        }
+        return Size;
+    }
+}
\ No newline at end of file
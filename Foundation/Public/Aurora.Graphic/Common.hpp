@@ -219,6 +219,12 @@ namespace Graphic
         BC3UIntNorm_sRGB,
         BC4UIntNorm,
         BC5UIntNorm,
+        BC7UIntNorm,
+        BC7UIntNorm_sRGB,
+        ETC2RGB8UIntNorm,
+        ETC2RGB8UIntNorm_sRGB,
+        ETC2RGBA8UIntNorm,
+        ETC2RGBA8UIntNorm_sRGB,
         R8SInt,
         R8SIntNorm,
         R8UInt,
@@ -420,6 +426,17 @@ namespace Graphic
 
         // -=(Undocumented)=-
         UInt16         Divisor = 0;
+
+        // -=(Undocumented)=-
+        template<typename Type>
+        void OnSerialize(Stream<Type> Archive)
+        {
+            Archive.SerializeEnum(ID);
+            Archive.SerializeEnum(Format);
+            Archive.SerializeInt(Slot);
+            Archive.SerializeInt(Offset);
+            Archive.SerializeInt(Divisor);
+        }
     };
 
     // -=(Undocumented)=-
@@ -450,6 +467,16 @@ namespace Graphic
         // -=(Undocumented)=-
         UInt8    Samples  = 1;
 
+        // Whether the device can sample block compressed (BC1 to BC7) textures.
+        Bool     BC       = false;
+
+        // Whether the device can sample ETC2 textures.
+        Bool     ETC2     = false;
+
+        // Identifies the driver that linked pipelines are persisted for, see \see PipelineCache. Empty when the
+        // driver does not persist them.
+        SStr     Identity;
+
         // -=(Undocumented)=-
         Vector<Adapter> Adapters;
     };
@@ -510,6 +537,34 @@ namespace Graphic
 
         // -=(Undocumented)=-
         VertexTopology InputTopology       = VertexTopology::Triangle;
+
+        // -=(Undocumented)=-
+        template<typename Type>
+        void OnSerialize(Stream<Type> Archive)
+        {
+            Archive.SerializeEnum(Cull);
+            Archive.SerializeBool(Fill);
+            Archive.SerializeEnum(BlendMask);
+            Archive.SerializeEnum(BlendColorSrcFactor);
+            Archive.SerializeEnum(BlendColorDstFactor);
+            Archive.SerializeEnum(BlendColorEquation);
+            Archive.SerializeEnum(BlendAlphaSrcFactor);
+            Archive.SerializeEnum(BlendAlphaDstFactor);
+            Archive.SerializeEnum(BlendAlphaEquation);
+            Archive.SerializeBool(DepthMask);
+            Archive.SerializeEnum(DepthCondition);
+            Archive.SerializeUInt8(StencilMask);
+            Archive.SerializeEnum(StencilCondition);
+            Archive.SerializeEnum(StencilOnFail);
+            Archive.SerializeEnum(StencilOnDepthFail);
+            Archive.SerializeEnum(StencilOnDepthPass);
+
+            for (Ref<Attribute> Element : InputLayout)
+            {
+                Archive.SerializeObject(Element);
+            }
+            Archive.SerializeEnum(InputTopology);
+        }
     };
 
     // -=(Undocumented)=-
@@ -523,6 +578,15 @@ namespace Graphic
 
         // -=(Undocumented)=-
         TextureFilter Filter = TextureFilter::Nearest;
+
+        // -=(Undocumented)=-
+        template<typename Type>
+        void OnSerialize(Stream<Type> Archive)
+        {
+            Archive.SerializeEnum(EdgeU);
+            Archive.SerializeEnum(EdgeV);
+            Archive.SerializeEnum(Filter);
+        }
     };
 
     // -=(Undocumented)=-
@@ -571,4 +635,16 @@ namespace Graphic
         // -=(Undocumented)=-
         Primitive                     Primitive;
     };
+
+    // Returns true if the format stores its texels in blocks of 4x4.
+    Bool IsCompressed(TextureFormat Format);
+
+    // Returns the size (in bytes) of a row of texels, or of a row of blocks for compressed formats.
+    UInt32 GetTexturePitch(TextureFormat Format, UInt16 Width);
+
+    // Returns the size (in bytes) of a single level, rounded up to whole blocks for compressed formats.
+    UInt32 GetTextureSize(TextureFormat Format, UInt16 Width, UInt16 Height);
+
+    // Returns the size (in bytes) of a chain of levels packed one after another, beginning with a level of the given size.
+    UInt32 GetTextureSize(TextureFormat Format, UInt16 Width, UInt16 Height, UInt8 Levels);
 }
\ No newline at end of file
@@ -0,0 +1,896 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2025 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Compression.hpp"
+#include <cmath>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Graphic
+{
+    // A block of 4x4 RGBA texels, in row major order.
+    using Block = Array<UInt8, 64>;
+
+    // Interpolation weights (out of 64) of the 4-bit indices of BC7.
+    static constexpr UInt32 k_BC7Weights[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+    // Modifiers of the ETC1/ETC2 intensity tables, the selectors pick (+a, +b, -a, -b) from each row.
+    static constexpr SInt32 k_ETCModifiers[8][2] = {
+        { 2, 8 }, { 5, 17 }, { 9, 29 }, { 13, 42 }, { 18, 60 }, { 24, 80 }, { 33, 106 }, { 47, 183 }
+    };
+
+    // Modifiers of the EAC alpha tables, scaled by the multiplier of the block.
+    static constexpr SInt32 k_EACModifiers[16][8] = {
+        { -3, -6,  -9, -15, 2, 5, 8, 14 }, { -3, -7, -10, -13, 2, 6, 9, 12 },
+        { -2, -5,  -8, -13, 1, 4, 7, 12 }, { -2, -4,  -6, -13, 1, 3, 5, 12 },
+        { -3, -6,  -8, -12, 2, 5, 7, 11 }, { -3, -7,  -9, -11, 2, 6, 8, 10 },
+        { -4, -7,  -8, -11, 3, 6, 7, 10 }, { -3, -5,  -8, -11, 2, 4, 7, 10 },
+        { -2, -6,  -8, -10, 1, 5, 7,  9 }, { -2, -5,  -8, -10, 1, 4, 7,  9 },
+        { -2, -4,  -8, -10, 1, 3, 7,  9 }, { -2, -5,  -7, -10, 1, 4, 6,  9 },
+        { -3, -4,  -7, -10, 2, 3, 6,  9 }, { -1, -2,  -3, -10, 0, 1, 2,  9 },
+        { -4, -6,  -8,  -9, 3, 5, 7,  8 }, { -3, -5,  -7,  -9, 2, 4, 6,  8 },
+    };
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static void Fetch(ConstPtr<UInt8> Texels, UInt32 Width, UInt32 Height, UInt32 X, UInt32 Y, Ref<Block> Output)
+    {
+        for (UInt32 Row = 0; Row < 4; ++Row)
+        {
+            for (UInt32 Column = 0; Column < 4; ++Column)
+            {
+                const UInt32 SourceX = Min(X + Column, Width  - 1);
+                const UInt32 SourceY = Min(Y + Row,    Height - 1);
+                std::memcpy(Output.data() + (Row * 4 + Column) * 4, Texels + (SourceY * Width + SourceX) * 4, 4);
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    template<UInt32 Channels>
+    static UInt32 Distance(ConstPtr<UInt8> Texel, ConstPtr<SInt32> Color)
+    {
+        UInt32 Error = 0;
+
+        for (UInt32 Channel = 0; Channel < Channels; ++Channel)
+        {
+            const SInt32 Delta = static_cast<SInt32>(Texel[Channel]) - Color[Channel];
+            Error += Delta * Delta;
+        }
+        return Error;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    template<UInt32 Channels>
+    static void FindEndpoints(ConstRef<Block> Texels, Real32 (&Low)[Channels], Real32 (&High)[Channels])
+    {
+        // Fit a line through the texels with their principal axis, the endpoints are their extremes along it.
+        Real32 Mean[Channels] = { };
+
+        for (UInt32 Texel = 0; Texel < 16; ++Texel)
+        {
+            for (UInt32 Channel = 0; Channel < Channels; ++Channel)
+            {
+                Mean[Channel] += Texels[Texel * 4 + Channel] / 16.0f;
+            }
+        }
+
+        Real32 Covariance[Channels][Channels] = { };
+
+        for (UInt32 Texel = 0; Texel < 16; ++Texel)
+        {
+            for (UInt32 Row = 0; Row < Channels; ++Row)
+            {
+                for (UInt32 Column = 0; Column < Channels; ++Column)
+                {
+                    Covariance[Row][Column] +=
+                        (Texels[Texel * 4 + Row] - Mean[Row]) * (Texels[Texel * 4 + Column] - Mean[Column]);
+                }
+            }
+        }
+
+        Real32 Axis[Channels];
+
+        for (UInt32 Channel = 0; Channel < Channels; ++Channel)
+        {
+            Axis[Channel] = 1.0f;
+        }
+
+        for (UInt32 Iteration = 0; Iteration < 8; ++Iteration)
+        {
+            Real32 Next[Channels] = { };
+            Real32 Length         = 0.0f;
+
+            for (UInt32 Row = 0; Row < Channels; ++Row)
+            {
+                for (UInt32 Column = 0; Column < Channels; ++Column)
+                {
+                    Next[Row] += Covariance[Row][Column] * Axis[Column];
+                }
+                Length = Max(Length, std::abs(Next[Row]));
+            }
+
+            if (Length <= 0.0f)
+            {
+                break;
+            }
+
+            for (UInt32 Channel = 0; Channel < Channels; ++Channel)
+            {
+                Axis[Channel] = Next[Channel] / Length;
+            }
+        }
+
+        Real32 Minimum = 0.0f;
+        Real32 Maximum = 0.0f;
+        Real32 Norm    = 0.0f;
+
+        for (UInt32 Channel = 0; Channel < Channels; ++Channel)
+        {
+            Norm += Axis[Channel] * Axis[Channel];
+        }
+
+        if (Norm > 0.0f)
+        {
+            for (UInt32 Texel = 0; Texel < 16; ++Texel)
+            {
+                Real32 Projection = 0.0f;
+
+                for (UInt32 Channel = 0; Channel < Channels; ++Channel)
+                {
+                    Projection += (Texels[Texel * 4 + Channel] - Mean[Channel]) * Axis[Channel];
+                }
+                Minimum = Min(Minimum, Projection / Norm);
+                Maximum = Max(Maximum, Projection / Norm);
+            }
+        }
+
+        for (UInt32 Channel = 0; Channel < Channels; ++Channel)
+        {
+            Low[Channel]  = Clamp(Mean[Channel] + Axis[Channel] * Minimum, 0.0f, 255.0f);
+            High[Channel] = Clamp(Mean[Channel] + Axis[Channel] * Maximum, 0.0f, 255.0f);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    template<UInt32 Channels>
+    static Bool RefineEndpoints(ConstRef<Block> Texels, ConstPtr<Real32> Weights, Real32 (&Low)[Channels], Real32 (&High)[Channels])
+    {
+        // Least squares fit of both endpoints, given the position (0 is Low, 1 is High) picked by every texel.
+        Real32 AA = 0.0f, AB = 0.0f, BB = 0.0f;
+        Real32 AX[Channels] = { };
+        Real32 BX[Channels] = { };
+
+        for (UInt32 Texel = 0; Texel < 16; ++Texel)
+        {
+            const Real32 B = Weights[Texel];
+            const Real32 A = 1.0f - B;
+
+            AA += A * A;
+            AB += A * B;
+            BB += B * B;
+
+            for (UInt32 Channel = 0; Channel < Channels; ++Channel)
+            {
+                AX[Channel] += A * Texels[Texel * 4 + Channel];
+                BX[Channel] += B * Texels[Texel * 4 + Channel];
+            }
+        }
+
+        const Real32 Determinant = AA * BB - AB * AB;
+
+        if (std::abs(Determinant) < 1e-6f)
+        {
+            return false;
+        }
+
+        for (UInt32 Channel = 0; Channel < Channels; ++Channel)
+        {
+            Low[Channel]  = Clamp((AX[Channel] * BB - BX[Channel] * AB) / Determinant, 0.0f, 255.0f);
+            High[Channel] = Clamp((BX[Channel] * AA - AX[Channel] * AB) / Determinant, 0.0f, 255.0f);
+        }
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static UInt16 Pack565(ConstPtr<Real32> Color)
+    {
+        const UInt32 Red   = static_cast<UInt32>(std::lround(Color[0] * 31.0f / 255.0f));
+        const UInt32 Green = static_cast<UInt32>(std::lround(Color[1] * 63.0f / 255.0f));
+        const UInt32 Blue  = static_cast<UInt32>(std::lround(Color[2] * 31.0f / 255.0f));
+        return static_cast<UInt16>((Red << 11) | (Green << 5) | Blue);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static void Unpack565(UInt16 Value, Ptr<SInt32> Color)
+    {
+        const UInt32 Red   = (Value >> 11) & 0x1F;
+        const UInt32 Green = (Value >> 5)  & 0x3F;
+        const UInt32 Blue  = (Value)       & 0x1F;
+
+        Color[0] = (Red   << 3) | (Red   >> 2);
+        Color[1] = (Green << 2) | (Green >> 4);
+        Color[2] = (Blue  << 3) | (Blue  >> 2);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static UInt32 FitColor(ConstRef<Block> Texels, UInt16 Color0, UInt16 Color1, Ref<UInt32> Indices, Ptr<Real32> Weights)
+    {
+        // Always in the four color mode, which is also the only one BC2 and BC3 decode.
+        static constexpr UInt32 k_Order[4]   = { 0, 3, 2, 1 };
+        static constexpr Real32 k_Weights[4] = { 0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f };
+
+        SInt32 Palette[4][3];
+        Unpack565(Color0, Palette[0]);
+        Unpack565(Color1, Palette[1]);
+
+        for (UInt32 Channel = 0; Channel < 3; ++Channel)
+        {
+            Palette[2][Channel] = (2 * Palette[0][Channel] + Palette[1][Channel]) / 3;
+            Palette[3][Channel] = (Palette[0][Channel] + 2 * Palette[1][Channel]) / 3;
+        }
+
+        UInt32 Error = 0;
+        Indices      = 0;
+
+        for (UInt32 Texel = 0; Texel < 16; ++Texel)
+        {
+            UInt32 Best      = 0;
+            UInt32 BestError = UINT32_MAX;
+
+            for (const UInt32 Index : k_Order)
+            {
+                if (const UInt32 Candidate = Distance<3>(Texels.data() + Texel * 4, Palette[Index]); Candidate < BestError)
+                {
+                    Best      = Index;
+                    BestError = Candidate;
+                }
+            }
+
+            Error   += BestError;
+            Indices |= Best << (Texel * 2);
+
+            if (Weights)
+            {
+                Weights[Texel] = k_Weights[Best];
+            }
+        }
+        return Error;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static void EncodeColor(ConstRef<Block> Texels, Ptr<UInt8> Output)
+    {
+        Real32 Low[3], High[3];
+        FindEndpoints<3>(Texels, Low, High);
+
+        UInt16 Color0 = Pack565(High);
+        UInt16 Color1 = Pack565(Low);
+        UInt32 Indices;
+        Real32 Weights[16];
+
+        if (Color0 < Color1)
+        {
+            std::swap(Color0, Color1);
+        }
+
+        UInt32 Error = FitColor(Texels, Color0, Color1, Indices, Weights);
+
+        // Refine the endpoints once with the indices just picked, and keep them if they are better.
+        if (Color0 != Color1 && RefineEndpoints<3>(Texels, Weights, High, Low))
+        {
+            UInt16 Refined0 = Pack565(High);
+            UInt16 Refined1 = Pack565(Low);
+            UInt32 RefinedIndices;
+
+            if (Refined0 < Refined1)
+            {
+                std::swap(Refined0, Refined1);
+            }
+
+            if (Refined0 != Refined1)
+            {
+                if (const UInt32 RefinedError = FitColor(Texels, Refined0, Refined1, RefinedIndices, nullptr); RefinedError < Error)
+                {
+                    Color0  = Refined0;
+                    Color1  = Refined1;
+                    Indices = RefinedIndices;
+                }
+            }
+        }
+
+        // Equal endpoints would select the three color mode in BC1, where the fourth index means transparent.
+        if (Color0 == Color1)
+        {
+            Indices = 0;
+        }
+
+        Output[0] = Color0 & 0xFF;
+        Output[1] = Color0 >> 8;
+        Output[2] = Color1 & 0xFF;
+        Output[3] = Color1 >> 8;
+        Output[4] = (Indices)       & 0xFF;
+        Output[5] = (Indices >> 8)  & 0xFF;
+        Output[6] = (Indices >> 16) & 0xFF;
+        Output[7] = (Indices >> 24) & 0xFF;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static void EncodeAlpha(ConstRef<Block> Texels, Ptr<UInt8> Output)
+    {
+        UInt32 Minimum = 255;
+        UInt32 Maximum = 0;
+
+        for (UInt32 Texel = 0; Texel < 16; ++Texel)
+        {
+            Minimum = Min<UInt32>(Minimum, Texels[Texel * 4 + 3]);
+            Maximum = Max<UInt32>(Maximum, Texels[Texel * 4 + 3]);
+        }
+
+        // Eight values mode, the endpoints followed by six interpolated steps.
+        SInt32 Palette[8] = { static_cast<SInt32>(Maximum), static_cast<SInt32>(Minimum) };
+
+        for (UInt32 Step = 1; Step < 7; ++Step)
+        {
+            Palette[Step + 1] = ((7 - Step) * Maximum + Step * Minimum) / 7;
+        }
+
+        UInt64 Indices = 0;
+
+        for (UInt32 Texel = 0; Texel < 16 && Minimum != Maximum; ++Texel)
+        {
+            UInt64 Best      = 0;
+            UInt32 BestError = UINT32_MAX;
+
+            for (UInt32 Index = 0; Index < 8; ++Index)
+            {
+                if (const UInt32 Candidate = Distance<1>(Texels.data() + Texel * 4 + 3, Palette + Index); Candidate < BestError)
+                {
+                    Best      = Index;
+                    BestError = Candidate;
+                }
+            }
+            Indices |= Best << (Texel * 3);
+        }
+
+        Output[0] = static_cast<UInt8>(Maximum);
+        Output[1] = static_cast<UInt8>(Minimum);
+
+        for (UInt32 Byte = 0; Byte < 6; ++Byte)
+        {
+            Output[2 + Byte] = static_cast<UInt8>(Indices >> (Byte * 8));
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static UInt32 QuantizeBC7(ConstPtr<Real32> Endpoint, Ptr<UInt32> Quantized, Ptr<SInt32> Color)
+    {
+        // Every endpoint has 7 bits per channel plus a bit shared by its four channels, pick the bit that fits best.
+        UInt32 BestBit   = 0;
+        UInt32 BestError = UINT32_MAX;
+
+        for (UInt32 Bit = 0; Bit < 2; ++Bit)
+        {
+            UInt32 Error = 0;
+
+            for (UInt32 Channel = 0; Channel < 4; ++Channel)
+            {
+                const SInt32 Value = Clamp<SInt32>(std::lround((Endpoint[Channel] - Bit) / 2.0f), 0, 127);
+                const SInt32 Delta = static_cast<SInt32>((Value << 1) | Bit) - static_cast<SInt32>(std::lround(Endpoint[Channel]));
+                Error += Delta * Delta;
+            }
+
+            if (Error < BestError)
+            {
+                BestBit   = Bit;
+                BestError = Error;
+            }
+        }
+
+        for (UInt32 Channel = 0; Channel < 4; ++Channel)
+        {
+            Quantized[Channel] = Clamp<SInt32>(std::lround((Endpoint[Channel] - BestBit) / 2.0f), 0, 127);
+            Color[Channel]     = (Quantized[Channel] << 1) | BestBit;
+        }
+        return BestBit;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static UInt32 FitBC7(ConstRef<Block> Texels, ConstPtr<SInt32> Color0, ConstPtr<SInt32> Color1, Ptr<UInt32> Indices, Ptr<Real32> Weights)
+    {
+        SInt32 Palette[16][4];
+
+        for (UInt32 Index = 0; Index < 16; ++Index)
+        {
+            for (UInt32 Channel = 0; Channel < 4; ++Channel)
+            {
+                Palette[Index][Channel] =
+                    ((64 - k_BC7Weights[Index]) * Color0[Channel] + k_BC7Weights[Index] * Color1[Channel] + 32) >> 6;
+            }
+        }
+
+        UInt32 Error = 0;
+
+        for (UInt32 Texel = 0; Texel < 16; ++Texel)
+        {
+            UInt32 Best      = 0;
+            UInt32 BestError = UINT32_MAX;
+
+            for (UInt32 Index = 0; Index < 16; ++Index)
+            {
+                if (const UInt32 Candidate = Distance<4>(Texels.data() + Texel * 4, Palette[Index]); Candidate < BestError)
+                {
+                    Best      = Index;
+                    BestError = Candidate;
+                }
+            }
+
+            Error         += BestError;
+            Indices[Texel] = Best;
+            Weights[Texel] = k_BC7Weights[Best] / 64.0f;
+        }
+        return Error;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static void EncodeBC7(ConstRef<Block> Texels, Ptr<UInt8> Output)
+    {
+        // Mode 6 only: a single subset with RGBA endpoints and 4-bit indices, which handles smooth gradients and
+        // alpha well, and is the fastest mode to search.
+        Real32 Endpoint0[4], Endpoint1[4];
+        FindEndpoints<4>(Texels, Endpoint0, Endpoint1);
+
+        UInt32 Quantized0[4], Quantized1[4], Bit0, Bit1;
+        SInt32 Color0[4], Color1[4];
+        UInt32 Indices[16];
+        Real32 Weights[16];
+
+        Bit0 = QuantizeBC7(Endpoint0, Quantized0, Color0);
+        Bit1 = QuantizeBC7(Endpoint1, Quantized1, Color1);
+
+        UInt32 Error = FitBC7(Texels, Color0, Color1, Indices, Weights);
+
+        for (UInt32 Iteration = 0; Iteration < 2 && Error > 0; ++Iteration)
+        {
+            if (! RefineEndpoints<4>(Texels, Weights, Endpoint0, Endpoint1))
+            {
+                break;
+            }
+
+            UInt32 RefinedQuantized0[4], RefinedQuantized1[4];
+            SInt32 RefinedColor0[4], RefinedColor1[4];
+            UInt32 RefinedIndices[16];
+            Real32 RefinedWeights[16];
+
+            const UInt32 RefinedBit0  = QuantizeBC7(Endpoint0, RefinedQuantized0, RefinedColor0);
+            const UInt32 RefinedBit1  = QuantizeBC7(Endpoint1, RefinedQuantized1, RefinedColor1);
+            const UInt32 RefinedError = FitBC7(Texels, RefinedColor0, RefinedColor1, RefinedIndices, RefinedWeights);
+
+            if (RefinedError >= Error)
+            {
+                break;
+            }
+
+            Error = RefinedError;
+            Bit0  = RefinedBit0;
+            Bit1  = RefinedBit1;
+            std::memcpy(Quantized0, RefinedQuantized0, sizeof(Quantized0));
+            std::memcpy(Quantized1, RefinedQuantized1, sizeof(Quantized1));
+            std::memcpy(Indices, RefinedIndices, sizeof(Indices));
+            std::memcpy(Weights, RefinedWeights, sizeof(Weights));
+        }
+
+        // The most significant bit of the first index is implicit (zero), swap the endpoints when it is set.
+        if (Indices[0] >= 8)
+        {
+            std::swap(Quantized0, Quantized1);
+            std::swap(Bit0, Bit1);
+
+            for (UInt32 Texel = 0; Texel < 16; ++Texel)
+            {
+                Indices[Texel] = 15 - Indices[Texel];
+            }
+        }
+
+        std::memset(Output, 0, 16);
+
+        UInt32 Offset = 0;
+
+        const auto Write = [&](UInt32 Value, UInt32 Bits)
+        {
+            for (UInt32 Bit = 0; Bit < Bits; ++Bit, ++Offset)
+            {
+                Output[Offset / 8] |= ((Value >> Bit) & 1) << (Offset % 8);
+            }
+        };
+
+        Write(1 << 6, 7);
+
+        for (UInt32 Channel = 0; Channel < 4; ++Channel)
+        {
+            Write(Quantized0[Channel], 7);
+            Write(Quantized1[Channel], 7);
+        }
+
+        Write(Bit0, 1);
+        Write(Bit1, 1);
+
+        for (UInt32 Texel = 0; Texel < 16; ++Texel)
+        {
+            Write(Indices[Texel], Texel == 0 ? 3 : 4);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static UInt32 FitETC(ConstRef<Block> Texels, ConstPtr<UInt32> Subblock, ConstPtr<SInt32> Base, Ref<UInt32> Table, Ptr<UInt32> Selectors)
+    {
+        UInt32 BestError = UINT32_MAX;
+
+        for (UInt32 Candidate = 0; Candidate < 8; ++Candidate)
+        {
+            const SInt32 Modifiers[4] = {
+                k_ETCModifiers[Candidate][0], k_ETCModifiers[Candidate][1], -k_ETCModifiers[Candidate][0], -k_ETCModifiers[Candidate][1]
+            };
+
+            UInt32 Error = 0;
+            UInt32 Picked[8];
+
+            for (UInt32 Texel = 0; Texel < 8; ++Texel)
+            {
+                UInt32 TexelError = UINT32_MAX;
+
+                for (UInt32 Selector = 0; Selector < 4; ++Selector)
+                {
+                    const SInt32 Color[3] = {
+                        Clamp(Base[0] + Modifiers[Selector], 0, 255),
+                        Clamp(Base[1] + Modifiers[Selector], 0, 255),
+                        Clamp(Base[2] + Modifiers[Selector], 0, 255),
+                    };
+
+                    if (const UInt32 Distance3 = Distance<3>(Texels.data() + Subblock[Texel] * 4, Color); Distance3 < TexelError)
+                    {
+                        TexelError    = Distance3;
+                        Picked[Texel] = Selector;
+                    }
+                }
+                Error += TexelError;
+            }
+
+            if (Error < BestError)
+            {
+                BestError = Error;
+                Table     = Candidate;
+                std::memcpy(Selectors, Picked, sizeof(Picked));
+            }
+        }
+        return BestError;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static void EncodeETC(ConstRef<Block> Texels, Ptr<UInt8> Output)
+    {
+        // Individual and differential modes of ETC1, which every ETC2 decoder understands as long as the differential
+        // colors do not overflow (they never do here, as both are quantized within range).
+        UInt64 BestBlock = 0;
+        UInt32 BestError = UINT32_MAX;
+
+        for (UInt32 Flip = 0; Flip < 2; ++Flip)
+        {
+            UInt32 Subblocks[2][8];
+
+            for (UInt32 Texel = 0, Count[2] = { }; Texel < 16; ++Texel)
+            {
+                const UInt32 X     = Texel % 4;
+                const UInt32 Y     = Texel / 4;
+                const UInt32 Index = (Flip ? Y : X) / 2;
+                Subblocks[Index][Count[Index]++] = Texel;
+            }
+
+            Real32 Average[2][3] = { };
+
+            for (UInt32 Index = 0; Index < 2; ++Index)
+            {
+                for (UInt32 Texel = 0; Texel < 8; ++Texel)
+                {
+                    for (UInt32 Channel = 0; Channel < 3; ++Channel)
+                    {
+                        Average[Index][Channel] += Texels[Subblocks[Index][Texel] * 4 + Channel] / 8.0f;
+                    }
+                }
+            }
+
+            for (UInt32 Differential = 0; Differential < 2; ++Differential)
+            {
+                const Real32 Scale = Differential ? 31.0f : 15.0f;
+
+                SInt32 Quantized[2][3];
+                SInt32 Base[2][3];
+
+                for (UInt32 Index = 0; Index < 2; ++Index)
+                {
+                    for (UInt32 Channel = 0; Channel < 3; ++Channel)
+                    {
+                        Quantized[Index][Channel] = std::lround(Average[Index][Channel] * Scale / 255.0f);
+                        Base[Index][Channel]      = Differential
+                            ? (Quantized[Index][Channel] << 3) | (Quantized[Index][Channel] >> 2)
+                            : (Quantized[Index][Channel] << 4) | (Quantized[Index][Channel]);
+                    }
+                }
+
+                Bool Representable = true;
+
+                for (UInt32 Channel = 0; Differential && Channel < 3; ++Channel)
+                {
+                    const SInt32 Delta = Quantized[1][Channel] - Quantized[0][Channel];
+                    Representable &= (Delta >= -4 && Delta <= 3);
+                }
+
+                if (! Representable)
+                {
+                    continue;
+                }
+
+                UInt32 Tables[2], Selectors[2][8];
+
+                const UInt32 Error = FitETC(Texels, Subblocks[0], Base[0], Tables[0], Selectors[0])
+                                   + FitETC(Texels, Subblocks[1], Base[1], Tables[1], Selectors[1]);
+
+                if (Error >= BestError)
+                {
+                    continue;
+                }
+
+                UInt64 Bits = 0;
+
+                for (UInt32 Channel = 0; Channel < 3; ++Channel)
+                {
+                    const UInt64 Value = Differential
+                        ? (Quantized[0][Channel] << 3) | ((Quantized[1][Channel] - Quantized[0][Channel]) & 0x7)
+                        : (Quantized[0][Channel] << 4) | (Quantized[1][Channel]);
+                    Bits |= Value << (56 - Channel * 8);
+                }
+
+                Bits |= static_cast<UInt64>((Tables[0] << 5) | (Tables[1] << 2) | (Differential << 1) | Flip) << 32;
+
+                for (UInt32 Index = 0; Index < 2; ++Index)
+                {
+                    for (UInt32 Texel = 0; Texel < 8; ++Texel)
+                    {
+                        // Selectors are stored in column major order, their high bits first.
+                        const UInt32 Position = (Subblocks[Index][Texel] % 4) * 4 + (Subblocks[Index][Texel] / 4);
+                        const UInt32 Selector = Selectors[Index][Texel];
+                        Bits |= static_cast<UInt64>(Selector >> 1) << (Position + 16);
+                        Bits |= static_cast<UInt64>(Selector & 1)  << (Position);
+                    }
+                }
+
+                BestBlock = Bits;
+                BestError = Error;
+            }
+        }
+
+        for (UInt32 Byte = 0; Byte < 8; ++Byte)
+        {
+            Output[Byte] = static_cast<UInt8>(BestBlock >> (56 - Byte * 8));
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static void EncodeEAC(ConstRef<Block> Texels, Ptr<UInt8> Output)
+    {
+        SInt32 Minimum = 255;
+        SInt32 Maximum = 0;
+
+        for (UInt32 Texel = 0; Texel < 16; ++Texel)
+        {
+            Minimum = Min<SInt32>(Minimum, Texels[Texel * 4 + 3]);
+            Maximum = Max<SInt32>(Maximum, Texels[Texel * 4 + 3]);
+        }
+
+        // A constant alpha uses the table with a zero modifier.
+        UInt32 BestBase = Maximum, BestTable = 13, BestMultiplier = 1, BestError = UINT32_MAX;
+        UInt64 BestIndices = 0;
+
+        for (UInt32 Texel = 0; Texel < 16; ++Texel)
+        {
+            BestIndices |= static_cast<UInt64>(4) << (45 - ((Texel % 4) * 4 + Texel / 4) * 3);
+        }
+
+        for (UInt32 Table = 0; Table < 16 && Minimum != Maximum; ++Table)
+        {
+            const SInt32 Lowest  = k_EACModifiers[Table][3];
+            const SInt32 Highest = k_EACModifiers[Table][7];
+
+            for (UInt32 Multiplier = 1; Multiplier < 16; ++Multiplier)
+            {
+                const SInt32 Center = (Minimum + Maximum) / 2 - ((Lowest + Highest) * static_cast<SInt32>(Multiplier)) / 2;
+
+                for (SInt32 Base = Center - 1; Base <= Center + 1; ++Base)
+                {
+                    if (Base < 0 || Base > 255)
+                    {
+                        continue;
+                    }
+
+                    UInt32 Error   = 0;
+                    UInt64 Indices = 0;
+
+                    for (UInt32 Texel = 0; Texel < 16 && Error < BestError; ++Texel)
+                    {
+                        UInt32 Best      = 0;
+                        UInt32 TexelError = UINT32_MAX;
+
+                        for (UInt32 Index = 0; Index < 8; ++Index)
+                        {
+                            const SInt32 Value = Clamp<SInt32>(Base + k_EACModifiers[Table][Index] * Multiplier, 0, 255);
+                            const SInt32 Delta = Value - Texels[Texel * 4 + 3];
+
+                            if (static_cast<UInt32>(Delta * Delta) < TexelError)
+                            {
+                                Best       = Index;
+                                TexelError = Delta * Delta;
+                            }
+                        }
+
+                        Error   += TexelError;
+                        Indices |= static_cast<UInt64>(Best) << (45 - ((Texel % 4) * 4 + Texel / 4) * 3);
+                    }
+
+                    if (Error < BestError)
+                    {
+                        BestBase       = Base;
+                        BestTable      = Table;
+                        BestMultiplier = Multiplier;
+                        BestError      = Error;
+                        BestIndices    = Indices;
+                    }
+                }
+            }
+        }
+
+        Output[0] = static_cast<UInt8>(BestBase);
+        Output[1] = static_cast<UInt8>((BestMultiplier << 4) | BestTable);
+
+        for (UInt32 Byte = 0; Byte < 6; ++Byte)
+        {
+            Output[2 + Byte] = static_cast<UInt8>(BestIndices >> (40 - Byte * 8));
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    TextureFormat GetCompressedFormat(TextureCompression Compression, Bool Alpha, Bool sRGB)
+    {
+        switch (Compression)
+        {
+        case TextureCompression::BC1:
+            return sRGB ? TextureFormat::BC1UIntNorm_sRGB : TextureFormat::BC1UIntNorm;
+        case TextureCompression::BC3:
+            return sRGB ? TextureFormat::BC3UIntNorm_sRGB : TextureFormat::BC3UIntNorm;
+        case TextureCompression::BC7:
+            return sRGB ? TextureFormat::BC7UIntNorm_sRGB : TextureFormat::BC7UIntNorm;
+        case TextureCompression::ETC2:
+            if (Alpha)
+            {
+                return sRGB ? TextureFormat::ETC2RGBA8UIntNorm_sRGB : TextureFormat::ETC2RGBA8UIntNorm;
+            }
+            return sRGB ? TextureFormat::ETC2RGB8UIntNorm_sRGB : TextureFormat::ETC2RGB8UIntNorm;
+        default:
+            return sRGB ? TextureFormat::RGBA8UIntNorm_sRGB : TextureFormat::RGBA8UIntNorm;
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Data Compress(CPtr<const UInt8> Texels, UInt16 Width, UInt16 Height, UInt8 Levels, TextureFormat Format)
+    {
+        using Encoder = void (*)(ConstRef<Block>, Ptr<UInt8>);
+
+        Encoder First  = nullptr;
+        Encoder Second = nullptr;
+
+        switch (Format)
+        {
+        case TextureFormat::BC1UIntNorm:
+        case TextureFormat::BC1UIntNorm_sRGB:
+            First  = EncodeColor;
+            break;
+        case TextureFormat::BC3UIntNorm:
+        case TextureFormat::BC3UIntNorm_sRGB:
+            First  = EncodeAlpha;
+            Second = EncodeColor;
+            break;
+        case TextureFormat::BC7UIntNorm:
+        case TextureFormat::BC7UIntNorm_sRGB:
+            First  = EncodeBC7;
+            break;
+        case TextureFormat::ETC2RGB8UIntNorm:
+        case TextureFormat::ETC2RGB8UIntNorm_sRGB:
+            First  = EncodeETC;
+            break;
+        case TextureFormat::ETC2RGBA8UIntNorm:
+        case TextureFormat::ETC2RGBA8UIntNorm_sRGB:
+            First  = EncodeEAC;
+            Second = EncodeETC;
+            break;
+        default:
+            return Data();
+        }
+
+        if (Texels.size() < GetTextureSize(TextureFormat::RGBA8UIntNorm, Width, Height, Levels))
+        {
+            return Data();
+        }
+
+        const UInt32 Stride = GetTextureSize(Format, 4, 4);
+
+        Data       Result(GetTextureSize(Format, Width, Height, Levels));
+        Ptr<UInt8> Output = Result.GetData<UInt8>();
+        Block      Input;
+
+        for (UInt8 Level = 0; Level < Levels; ++Level)
+        {
+            for (UInt32 Y = 0; Y < Height; Y += 4)
+            {
+                for (UInt32 X = 0; X < Width; X += 4, Output += Stride)
+                {
+                    Fetch(Texels.data(), Width, Height, X, Y, Input);
+
+                    First(Input, Output);
+
+                    if (Second)
+                    {
+                        Second(Input, Output + Stride / 2);
+                    }
+                }
+            }
+
+            Texels = Texels.subspan(static_cast<UInt32>(Width) * Height * 4);
+            Width  = Max<UInt16>(1, Width  >> 1);
+            Height = Max<UInt16>(1, Height >> 1);
+        }
+        return Result;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,39 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2025 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Common.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Graphic
+{
+    // Family of block compressed formats an image can be encoded to.
+    enum class TextureCompression : UInt8
+    {
+        None,       // Keeps the texels uncompressed.
+        BC1,        // 4 bits per texel, opaque.
+        BC3,        // 8 bits per texel, BC1 color with a separate alpha block.
+        BC7,        // 8 bits per texel, the best quality of the desktop formats.
+        ETC2,       // 4 bits per texel when opaque and 8 with alpha, the format every GLES 3.0 device can sample.
+    };
+
+    // Returns the format an RGBA8 image is encoded to, or \see TextureFormat::RGBA8UIntNorm when not compressed.
+    TextureFormat GetCompressedFormat(TextureCompression Compression, Bool Alpha, Bool sRGB);
+
+    // Encodes a chain of RGBA8 levels (as produced by \see GenerateMipmaps) into the given compressed format, keeping the
+    // levels packed one after another. Levels smaller than a block are padded by repeating their edge texels.
+    Data Compress(CPtr<const UInt8> Texels, UInt16 Width, UInt16 Height, UInt8 Levels, TextureFormat Format);
+}
\ No newline at end of file
@@ -12,7 +12,7 @@
 // [  HEADER  ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-#include "Common.hpp"
+#include "PipelineCache.hpp"
 #include "Aurora.Math/Color.hpp"
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -38,6 +38,9 @@ namespace Graphic
         // -=(Undocumented)=-
         virtual ConstRef<Capabilities> GetCapabilities() const = 0;
 
+        // Sets the storage linked pipelines are persisted to, drivers unable to retrieve their binaries ignore it.
+        virtual void SetPipelineCache(Any<PipelineCache> Cache) = 0;
+
         // -=(Undocumented)=-
         virtual void CreateBuffer(Object ID, Usage Type, Bool Immutable, ConstPtr<UInt8> Data, UInt32 Length) = 0;
 
@@ -56,8 +59,8 @@ namespace Graphic
         // -=(Undocumented)=-
         virtual void DeletePass(Object ID) = 0;
 
-        // -=(Undocumented)=-
-        virtual void CreatePipeline(Object ID, CPtr<const UInt8> Vertex, CPtr<const UInt8> Fragment, CPtr<const UInt8> Geometry, ConstRef<Descriptor> Properties) = 0;
+        // Creates a pipeline from its stages, restoring it from the cache entry instead when the entry is usable.
+        virtual void CreatePipeline(Object ID, CPtr<const UInt8> Vertex, CPtr<const UInt8> Fragment, CPtr<const UInt8> Geometry, CPtr<const UInt8> Cache, ConstRef<Descriptor> Properties) = 0;
 
         // -=(Undocumented)=-
         virtual void DeletePipeline(Object ID) = 0;
@@ -22,19 +22,46 @@ namespace Graphic
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
     Font::Font(Any<Content::Uri> Key)
-        : AbstractResource(Move(Key))
+        : AbstractResource(Move(Key)),
+          mFallback { k_MissingGlyph }
     {
+        mDirect.fill(k_MissingGlyph);
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-    void Font::Load(Any<Metrics> Metrics, Any<Atlas> Atlas, Any<Table<UInt32, Glyph>> Glyphs, Any<Table<UInt64, Real32>> Kerning)
+    void Font::Load(Any<Metrics> Metrics, Any<Vector<Atlas>> Pages, Any<Vector<Glyph>> Glyphs, Any<Vector<Kerning>> Kerning)
     {
         mMetrics = Move(Metrics);
-        mAtlas   = Move(Atlas);
+        mPages   = Move(Pages);
         mGlyphs  = Move(Glyphs);
         mKerning = Move(Kerning);
+
+        // Sorting by codepoint places the glyphs of the direct table first, keeping their indices small.
+        Sort(mGlyphs, [](ConstRef<Glyph> Left, ConstRef<Glyph> Right)
+        {
+            return Left.Codepoint < Right.Codepoint;
+        });
+
+        mDirect.fill(k_MissingGlyph);
+        mIndices.clear();
+        mIndices.reserve(mGlyphs.size());
+
+        for (UInt32 Index = 0; Index < mGlyphs.size(); ++Index)
+        {
+            if (const UInt32 Codepoint = mGlyphs[Index].Codepoint; Codepoint < k_DirectGlyphs)
+            {
+                mDirect[Codepoint] = Index;
+            }
+            else
+            {
+                mIndices.try_emplace(Codepoint, Index);
+            }
+        }
+
+        // Resolve the fallback once, instead of on every missing codepoint.
+        mFallback = mDirect['?'];
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -92,7 +119,9 @@ namespace Graphic
         Real32 MaximumX = 0.0f;
         Real32 MaximumY = mMetrics.UnderlineHeight;
 
-        for (UInt Previous = 0, Symbol = 0; Symbol < Text.size(); ++Symbol)
+        ConstPtr<Glyph> Previous = nullptr;
+
+        for (UInt Symbol = 0; Symbol < Text.size(); ++Symbol)
         {
             const UInt Codepoint = Text[Symbol];
 
@@ -100,19 +129,25 @@ namespace Graphic
             {
             case '\r':
                 CurrentX = 0.0f;
+                Previous = nullptr;
                 break;
             case '\n':
                 MaximumY += mMetrics.UnderlineHeight;
+                Previous = nullptr;
                 break;
             default:
             {
                 const ConstPtr<Glyph> Glyph = GetGlyph(Codepoint);
-                CurrentX += (GetKerning(Previous, Codepoint) + Glyph->Advance);
-                MaximumX = Max(MaximumX, CurrentX);
+
+                if (Glyph)
+                {
+                    CurrentX += (GetKerning(Previous, Codepoint) + Glyph->Advance);
+                    MaximumX = Max(MaximumX, CurrentX);
+                }
+                Previous = Glyph;
                 break;
             }
             }
-            Previous = Codepoint;
         }
         return Vector2f(MaximumX, MaximumY) * Size;
     }
@@ -122,27 +157,42 @@ namespace Graphic
 
     Bool Font::OnCreate(Ref<Subsystem::Context> Context)
     {
-        SetMemory(mGlyphs.size() * sizeof(Glyph));
+        SetMemory(mGlyphs.size() * sizeof(Glyph) + mKerning.size() * sizeof(Kerning) + mIndices.size() * sizeof(UInt64));
+
+        // Allocates a texture and a material for each page of the atlas, so that the glyphs of a page are batched.
+        constexpr UInt8   k_DefaultMipmaps = 1;
+        constexpr UInt8   k_DefaultSamples = 1;
+        constexpr Sampler k_DefaultSampler = Sampler(TextureEdge::Repeat, TextureEdge::Repeat, TextureFilter::Bilinear);
 
-        // Allocates texture for the atlas
-        constexpr UInt8 k_DefaultMipmaps = 1;
-        constexpr UInt8 k_DefaultSamples = 1;
+        mMaterials.clear();
+        mMaterials.reserve(mPages.size());
 
-        const SPtr<Texture> Atlas = NewPtr<Texture>(Content::Uri::Merge(GetKey(), "Atlas"));
-        Atlas->Load(
-            TextureFormat::RGBA8UIntNorm,
-            TextureLayout::Source, mAtlas.Width, mAtlas.Height, k_DefaultMipmaps, k_DefaultSamples, Move(mAtlas.Bytes));
+        for (UInt32 Page = 0; Page < mPages.size(); ++Page)
+        {
+            // The first page keeps the names used by single page fonts.
+            const SStr Suffix = Page > 0 ? Format("{}", Page) : SStr();
 
-        // Allocates material for the font
-        constexpr Sampler k_DefaultSampler = Sampler(TextureEdge::Repeat, TextureEdge::Repeat, TextureFilter::Bilinear);
+            Ref<Font::Atlas> Source = mPages[Page];
 
-        mMaterial = NewPtr<Material>(Content::Uri::Merge(GetKey(), "Material"));
-        mMaterial->SetExclusive(true);
-        mMaterial->SetKind(Material::Kind::Normal);
-        mMaterial->SetTexture(TextureSlot::Diffuse, Atlas);
-        mMaterial->SetSampler(TextureSlot::Diffuse, k_DefaultSampler);
-        mMaterial->SetParameter(0, Vector3f(Atlas->GetWidth(), Atlas->GetHeight(), mMetrics.Distance));
-        return mMaterial->Create(Context);
+            const SPtr<Texture> Atlas = NewPtr<Texture>(Content::Uri::Merge(GetKey(), "Atlas" + Suffix));
+            Atlas->Load(
+                TextureFormat::RGBA8UIntNorm,
+                TextureLayout::Source, Source.Width, Source.Height, k_DefaultMipmaps, k_DefaultSamples, Move(Source.Bytes));
+
+            const SPtr<Material> Sheet = NewPtr<Material>(Content::Uri::Merge(GetKey(), "Material" + Suffix));
+            Sheet->SetExclusive(true);
+            Sheet->SetKind(Material::Kind::Normal);
+            Sheet->SetTexture(TextureSlot::Diffuse, Atlas);
+            Sheet->SetSampler(TextureSlot::Diffuse, k_DefaultSampler);
+            Sheet->SetParameter(0, Vector3f(Atlas->GetWidth(), Atlas->GetHeight(), mMetrics.Distance));
+            mMaterials.emplace_back(Sheet);
+
+            if (!Sheet->Create(Context))
+            {
+                return false;
+            }
+        }
+        return !mMaterials.empty();
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -150,9 +200,10 @@ namespace Graphic
 
     void Font::OnDelete(Ref<Subsystem::Context> Context)
     {
-        if (mMaterial)
+        for (ConstSPtr<Material> Sheet : mMaterials)
         {
-            mMaterial->Delete(Context);
+            Sheet->Delete(Context);
         }
+        mMaterials.clear();
     }
 }
\ No newline at end of file
@@ -43,6 +43,9 @@ namespace Graphic
         // -=(Undocumented)=-
         struct Glyph
         {
+            // -=(Undocumented)=-
+            UInt32 Codepoint;
+
             // -=(Undocumented)=-
             Real32 Advance;
 
@@ -51,6 +54,25 @@ namespace Graphic
 
             // -=(Undocumented)=-
             Rectf  ImageBounds;
+
+            // Index of the atlas page the glyph is stored in.
+            UInt32 Page;
+
+            // Range of the kerning table holding the pairs the glyph begins, sorted by their second codepoint.
+            UInt32 KerningOffset;
+
+            // -=(Undocumented)=-
+            UInt32 KerningCount;
+        };
+
+        // Adjustment applied between a glyph and the one that follows it.
+        struct Kerning
+        {
+            // -=(Undocumented)=-
+            UInt32 Codepoint;
+
+            // -=(Undocumented)=-
+            Real32 Advance;
         };
 
         // -=(Undocumented)=-
@@ -78,13 +100,23 @@ namespace Graphic
             Real32 UnderlineThickness;
         };
 
+    public:
+
+        // Number of leading codepoints (Basic Latin and Latin-1) whose glyphs are found without hashing.
+        static constexpr UInt32 k_DirectGlyphs = 256;
+
+        // Marks an entry of the direct table that has no glyph.
+        static constexpr UInt16 k_MissingGlyph = 0xFFFF;
+
     public:
 
         // -=(Undocumented)=-
         explicit Font(Any<Content::Uri> Key);
 
         // -=(Undocumented)=-
-        void Load(Any<Metrics> Metrics, Any<Atlas> Atlas, Any<Table<UInt32, Glyph>> Glyphs, Any<Table<UInt64, Real32>> Kerning);
+        // Loads the font, every glyph must reference a page of the atlas and a range of the kerning table as described
+        // by \see Glyph, a fallback glyph is used for codepoints that are missing ('?' when present).
+        void Load(Any<Metrics> Metrics, Any<Vector<Atlas>> Pages, Any<Vector<Glyph>> Glyphs, Any<Vector<Kerning>> Kerning);
 
         // -=(Undocumented)=-
         Rectf Calculate(CStr16 Text, Real32 Size, Pivot Pivot) const;
@@ -98,27 +130,55 @@ namespace Graphic
             return mMetrics;
         }
 
-        // -=(Undocumented)=-
-        ConstPtr<Glyph> GetGlyph(UInt32 Unicode, UInt32 Fallback = '?') const
+        // Returns the glyph of the given codepoint, or the fallback glyph (which may be null) when the font has none.
+        ConstPtr<Glyph> GetGlyph(UInt32 Unicode) const
         {
-            if (const auto Iterator = mGlyphs.find(Unicode); Iterator != mGlyphs.end())
+            UInt32 Index = mFallback;
+
+            if (Unicode < k_DirectGlyphs)
+            {
+                Index = mDirect[Unicode] != k_MissingGlyph ? mDirect[Unicode] : mFallback;
+            }
+            else if (const auto Iterator = mIndices.find(Unicode); Iterator != mIndices.end())
             {
-                return AddressOf(Iterator->second);
+                Index = Iterator->second;
             }
-            return Fallback != 0 && Unicode != Fallback ? GetGlyph(Fallback, 0) : nullptr;
+            return Index < mGlyphs.size() ? AddressOf(mGlyphs[Index]) : nullptr;
+        }
+
+        // Returns the adjustment between the given glyph and the codepoint that follows it.
+        Real32 GetKerning(ConstPtr<Glyph> First, UInt32 Second) const
+        {
+            if (First == nullptr || First->KerningCount == 0)
+            {
+                return 0.0f;
+            }
+
+            const auto Begin    = mKerning.begin() + First->KerningOffset;
+            const auto End      = Begin + First->KerningCount;
+            const auto Iterator = std::lower_bound(Begin, End, Second, [](ConstRef<Kerning> Pair, UInt32 Codepoint)
+            {
+                return Pair.Codepoint < Codepoint;
+            });
+            return Iterator != End && Iterator->Codepoint == Second ? Iterator->Advance : 0.0f;
         }
 
         // -=(Undocumented)=-
         Real32 GetKerning(UInt32 First, UInt32 Second) const
         {
-            const auto Iterator = mKerning.find(static_cast<UInt64>(First) << 32 | Second);
-            return Iterator == mKerning.end() ? 0.0f : Iterator->second;
+            return GetKerning(GetGlyph(First), Second);
         }
 
         // -=(Undocumented)=-
-        ConstSPtr<Material> GetMaterial() const
+        UInt32 GetPages() const
+        {
+            return mMaterials.size();
+        }
+
+        // Returns the material that draws the glyphs of the given atlas page.
+        ConstSPtr<Material> GetMaterial(UInt32 Page = 0) const
         {
-            return mMaterial;
+            return Page < mMaterials.size() ? mMaterials[Page] : nullptr;
         }
 
     private:
@@ -134,10 +194,13 @@ namespace Graphic
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-        Metrics               mMetrics;
-        Table<UInt32, Glyph>  mGlyphs;
-        Table<UInt64, Real32> mKerning;
-        Atlas                 mAtlas;       // TODO: Support multiple page atlas
-        SPtr<Material>        mMaterial;
+        Metrics                         mMetrics;
+        Vector<Glyph>                   mGlyphs;
+        Array<UInt16, k_DirectGlyphs>   mDirect;
+        Table<UInt32, UInt32>           mIndices;
+        UInt32                          mFallback;
+        Vector<Kerning>                 mKerning;
+        Vector<Atlas>                   mPages;
+        Vector<SPtr<Material>>          mMaterials;
     };
 }
\ No newline at end of file
@@ -23,7 +23,9 @@ namespace Graphic
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
     Mesh::Mesh(Any<Content::Uri> Key)
-        : AbstractResource(Move(Key))
+        : AbstractResource(Move(Key)),
+          mErrors { },
+          mLevels { 1 }
     {
     }
 
@@ -39,6 +41,70 @@ namespace Graphic
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+    void Mesh::AddPrimitive(Any<Primitive> Data)
+    {
+        // The mesh switches level as a whole, so each level takes the error of its worst primitive.
+        for (UInt8 Index = 0; Index < Data.Levels.size() && Data.Levels[Index].Indices.Length > 0; ++Index)
+        {
+            mErrors[Index + 1] = Max(mErrors[Index + 1], Data.Levels[Index].Error);
+            mLevels            = Max<UInt8>(mLevels, Index + 2);
+        }
+
+        mMinimum = (mPrimitives.empty() ? Data.Minimum : Vector3f::Min(mMinimum, Data.Minimum));
+        mMaximum = (mPrimitives.empty() ? Data.Maximum : Vector3f::Max(mMaximum, Data.Maximum));
+
+        mPrimitives.emplace_back(Move(Data));
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt8 Mesh::GetLevel(ConstRef<Camera> Viewer, ConstRef<Vector3f> Position, ConstRef<Rectf> Viewport, Real32 Tolerance) const
+    {
+        const Real32 Scale = Viewer.GetScreenSize(Position, 1.0f, Viewport);
+
+        for (UInt8 Level = mLevels - 1; Level > 0; --Level)
+        {
+            if (mErrors[Level] * Scale <= Tolerance)
+            {
+                return Level;
+            }
+        }
+        return 0;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool Mesh::IsCompatible(ConstRef<Descriptor> Properties) const
+    {
+        const CPtr<const Primitive> Primitives = GetPrimitives();
+        Bool                        Compatible = true;
+
+        for (UInt32 Index = 0; Index < Primitives.size(); ++Index)
+        {
+            for (ConstRef<Graphic::Attribute> Input : Properties.InputLayout)
+            {
+                if (Input.ID == VertexSemantic::None)
+                {
+                    continue;
+                }
+
+                if (ConstRef<Attribute> Stream = Primitives[Index].GetAttribute(Input.ID);
+                    Stream.Length > 0 && Stream.Format != Input.Format)
+                {
+                    Log::Error("Mesh: '{}' primitive {} stores {} as {}, but the pipeline reads it as {}",
+                        GetKey().GetUrl(), Index, NameEnum(Input.ID), NameEnum(Stream.Format), NameEnum(Input.Format));
+                    Compatible = false;
+                }
+            }
+        }
+        return Compatible;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
     Bool Mesh::OnCreate(Ref<Subsystem::Context> Context)
     {
         for (ConstRef<Data> Bytes : mBytes)
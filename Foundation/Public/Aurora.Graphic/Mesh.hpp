@@ -12,6 +12,7 @@
 // [  HEADER  ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+#include "Camera.hpp"
 #include "Common.hpp"
 #include "Aurora.Content/Resource.hpp"
 
@@ -29,29 +30,60 @@ namespace Graphic
     public:
 
         // -=(Undocumented)=-
-        static constexpr UInt k_MaxBuffers    = 2;
+        static constexpr UInt k_MaxBuffers = 2;
 
-        // -=(Undocumented)=-
-        static constexpr UInt k_MaxPrimitives = 16;
+        // Number of levels of detail of each primitive, including the full-detail one.
+        static constexpr UInt k_MaxLevels  = 4;
 
         // -=(Undocumented)=-
         struct Attribute
         {
             // -=(Undocumented)=-
-            UInt32 Length = 0;
+            UInt32       Length = 0;
+
+            // -=(Undocumented)=-
+            UInt32       Offset = 0;
+
+            // -=(Undocumented)=-
+            UInt32       Stride = 0;
+
+            // Layout of each element, which differs from the source when the attribute has been quantized.
+            VertexFormat Format = VertexFormat::Float32x4;
+
+            // -=(Undocumented)=-
+            template<typename Type>
+            void OnSerialize(Stream<Type> Archive)
+            {
+                Archive.SerializeInt(Length);
+                Archive.SerializeInt(Offset);
+                Archive.SerializeInt(Stride);
+                Archive.SerializeEnum(Format);
+            }
+        };
 
+        // -=(Undocumented)=-
+        struct Level
+        {
             // -=(Undocumented)=-
-            UInt32 Offset = 0;
+            Attribute Indices;
+
+            // Largest distance between the simplified surface and the full-detail one, in model units.
+            Real32    Error = 0.0f;
 
             // -=(Undocumented)=-
-            UInt32 Stride = 0;
+            template<typename Type>
+            void OnSerialize(Stream<Type> Archive)
+            {
+                Archive.SerializeObject(Indices);
+                Archive.SerializeReal32(Error);
+            }
         };
 
         // -=(Undocumented)=-
         struct Primitive
         {
             // -=(Undocumented)=-
-            SInt8                             Material = -1;
+            SInt16                            Material = -1;
 
             // -=(Undocumented)=-
             Attribute                         Indices;
@@ -59,11 +91,46 @@ namespace Graphic
             // -=(Undocumented)=-
             Array<Attribute, k_MaxAttributes> Attributes;
 
+            // Coarser versions of the primitive, from the finest to the coarsest. They share the vertices of the
+            // primitive and only differ in the triangles they index; unused ones have no indices.
+            Array<Level, k_MaxLevels - 1>     Levels;
+
+            // Corners of the box bounding every vertex of the primitive, in model units.
+            Vector3f                          Minimum;
+
+            // -=(Undocumented)=-
+            Vector3f                          Maximum;
+
             // -=(Undocumented)=-
             ConstRef<Attribute> GetAttribute(VertexSemantic Semantic) const
             {
                 return Attributes[CastEnum(Semantic)];
             }
+
+            // Returns the indices to draw at the given level of detail, or at the coarsest one available below it.
+            ConstRef<Attribute> GetIndices(UInt8 Detail) const
+            {
+                for (UInt8 Index = Min<UInt8>(Detail, k_MaxLevels - 1); Index > 0; --Index)
+                {
+                    if (Levels[Index - 1].Indices.Length > 0)
+                    {
+                        return Levels[Index - 1].Indices;
+                    }
+                }
+                return Indices;
+            }
+
+            // -=(Undocumented)=-
+            template<typename Type>
+            void OnSerialize(Stream<Type> Archive)
+            {
+                Archive.SerializeInt16(Material);
+                Archive.SerializeObject(Indices);
+                Archive.SerializeArray(Attributes);
+                Archive.SerializeArray(Levels);
+                Archive.SerializeObject(Minimum);
+                Archive.SerializeObject(Maximum);
+            }
         };
 
     public:
@@ -81,18 +148,10 @@ namespace Graphic
         }
 
         // -=(Undocumented)=-
-        Bool AddPrimitive(Any<Primitive> Data)
-        {
-            if (const UInt32 Handle = mPrimitives.Allocate(); Handle > 0)
-            {
-                mPrimitives[Handle] = Move(Data);
-                return true;
-            }
-            return false;
-        }
+        void AddPrimitive(Any<Primitive> Data);
 
         // -=(Undocumented)=-
-        ConstRef<Primitive> GetPrimitive(UInt8 Primitive) const
+        ConstRef<Primitive> GetPrimitive(UInt32 Primitive) const
         {
             return mPrimitives[Primitive];
         }
@@ -100,9 +159,36 @@ namespace Graphic
         // -=(Undocumented)=-
         CPtr<const Primitive> GetPrimitives() const
         {
-            return mPrimitives.GetContent();
+            return mPrimitives;
         }
 
+        // Returns the lower corner of the box bounding every primitive, in model units.
+        ConstRef<Vector3f> GetMinimum() const
+        {
+            return mMinimum;
+        }
+
+        // Returns the upper corner of the box bounding every primitive, in model units.
+        ConstRef<Vector3f> GetMaximum() const
+        {
+            return mMaximum;
+        }
+
+        // -=(Undocumented)=-
+        UInt8 GetLevels() const
+        {
+            return mLevels;
+        }
+
+        // Whether every attribute the pipeline's layout reads is stored by each primitive in the format the layout
+        // expects, logging every mismatch; quantized meshes store some attributes in a narrower format.
+        Bool IsCompatible(ConstRef<Descriptor> Properties) const;
+
+        // Selects the coarsest level of detail whose error, projected on the viewport by the camera with the mesh at
+        // the given position, covers no more than 'Tolerance' pixels.
+        UInt8 GetLevel(
+            ConstRef<Camera> Viewer, ConstRef<Vector3f> Position, ConstRef<Rectf> Viewport, Real32 Tolerance = 1.0f) const;
+
     private:
 
         // \see Resource::OnCreate(Ref<Subsystem::Context>)
@@ -116,8 +202,12 @@ namespace Graphic
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-        Array<Data, k_MaxBuffers>        mBytes;
-        Array<Object, k_MaxBuffers>      mBuffers;
-        Pool<Primitive, k_MaxPrimitives> mPrimitives;
+        Array<Data, k_MaxBuffers>   mBytes;
+        Array<Object, k_MaxBuffers> mBuffers;
+        Vector<Primitive>           mPrimitives;
+        Vector3f                    mMinimum;
+        Vector3f                    mMaximum;
+        Array<Real32, k_MaxLevels>  mErrors;
+        UInt8                       mLevels;
     };
 }
@@ -0,0 +1,472 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2025 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Mipmap.hpp"
+#include <bit>
+#include <cmath>
+#include <numbers>
+
+#if   defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+
+    #include <emmintrin.h>
+
+    #define AE_MIPMAP_SSE2
+
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+
+    #include <arm_neon.h>
+
+    #define AE_MIPMAP_NEON
+
+#endif
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Graphic
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    // Number of taps of the Kaiser filter, which covers three texels at each side of the destination texel's center.
+    static constexpr UInt32 k_KaiserTaps  = 6;
+
+    // -=(Undocumented)=-
+    static constexpr Real64 k_KaiserAlpha = 4.0;
+
+    // Resolution of the table used to encode linear values back to sRGB, fine enough to round every value correctly.
+    static constexpr UInt32 k_EncodeSteps = 16384;
+
+#if   defined(AE_MIPMAP_SSE2)
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    using Lane = __m128;
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Lane LoadLane(ConstPtr<Real32> Address)
+    {
+        return _mm_loadu_ps(Address);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static void StoreLane(Ptr<Real32> Address, Lane Value)
+    {
+        _mm_storeu_ps(Address, Value);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Lane ZeroLane()
+    {
+        return _mm_setzero_ps();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Lane MultiplyAddLane(Lane Accumulator, Lane Value, Real32 Factor)
+    {
+        return _mm_add_ps(Accumulator, _mm_mul_ps(Value, _mm_set1_ps(Factor)));
+    }
+
+#elif defined(AE_MIPMAP_NEON)
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    using Lane = float32x4_t;
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Lane LoadLane(ConstPtr<Real32> Address)
+    {
+        return vld1q_f32(Address);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static void StoreLane(Ptr<Real32> Address, Lane Value)
+    {
+        vst1q_f32(Address, Value);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Lane ZeroLane()
+    {
+        return vdupq_n_f32(0.0f);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Lane MultiplyAddLane(Lane Accumulator, Lane Value, Real32 Factor)
+    {
+        return vmlaq_n_f32(Accumulator, Value, Factor);
+    }
+
+#else
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    struct Lane
+    {
+        Real32 Channels[4];
+    };
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Lane LoadLane(ConstPtr<Real32> Address)
+    {
+        return Lane { Address[0], Address[1], Address[2], Address[3] };
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static void StoreLane(Ptr<Real32> Address, Lane Value)
+    {
+        std::memcpy(Address, Value.Channels, sizeof(Value.Channels));
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Lane ZeroLane()
+    {
+        return Lane { };
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Lane MultiplyAddLane(Lane Accumulator, Lane Value, Real32 Factor)
+    {
+        for (UInt32 Channel = 0; Channel < 4; ++Channel)
+        {
+            Accumulator.Channels[Channel] += Value.Channels[Channel] * Factor;
+        }
+        return Accumulator;
+    }
+
+#endif
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Real64 Bessel(Real64 Value)
+    {
+        // Modified Bessel function of the first kind and order zero, the series converges quickly for the
+        // small arguments used by the window.
+        Real64 Result = 1.0;
+        Real64 Term   = 1.0;
+
+        for (UInt32 Index = 1; Index < 32; ++Index)
+        {
+            Term   *= (Value * 0.5) / Index;
+            Result += Term * Term;
+        }
+        return Result;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Array<Real32, k_KaiserTaps> CreateKaiserWeights()
+    {
+        constexpr Real64 k_Radius = k_KaiserTaps / 2;
+
+        Array<Real32, k_KaiserTaps> Weights;
+        Real64                      Total = 0.0;
+
+        for (UInt32 Tap = 0; Tap < k_KaiserTaps; ++Tap)
+        {
+            // Distance (in source texels) from the center of the destination texel, which lies between two texels.
+            const Real64 Distance = (Tap + 0.5) - k_Radius;
+
+            // A low pass at half the source's frequency, windowed so that it falls to zero at the edge of the support.
+            const Real64 Phase  = std::numbers::pi * Distance * 0.5;
+            const Real64 Sinc   = std::sin(Phase) / Phase;
+            const Real64 Ratio  = Distance / k_Radius;
+            const Real64 Window = Bessel(k_KaiserAlpha * std::sqrt(1.0 - Ratio * Ratio)) / Bessel(k_KaiserAlpha);
+
+            Weights[Tap] = static_cast<Real32>(Sinc * Window);
+            Total       += Weights[Tap];
+        }
+
+        for (Ref<Real32> Weight : Weights)
+        {
+            Weight = static_cast<Real32>(Weight / Total);
+        }
+        return Weights;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Real32 DecodeSRGB(Real32 Value)
+    {
+        return Value <= 0.04045f ? Value / 12.92f : std::pow((Value + 0.055f) / 1.055f, 2.4f);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Real32 EncodeSRGB(Real32 Value)
+    {
+        return Value <= 0.0031308f ? Value * 12.92f : 1.055f * std::pow(Value, 1.0f / 2.4f) - 0.055f;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static void Decode(CPtr<const UInt8> Texels, Ptr<Real32> Output, Bool sRGB)
+    {
+        static const Array<Real32, 256> s_Linear = []
+        {
+            Array<Real32, 256> Table;
+
+            for (UInt32 Index = 0; Index < Table.size(); ++Index)
+            {
+                Table[Index] = DecodeSRGB(Index / 255.0f);
+            }
+            return Table;
+        }();
+
+        for (UInt32 Index = 0; Index < Texels.size(); ++Index)
+        {
+            const Bool Color = sRGB && (Index & 3) != 3;
+
+            Output[Index] = Color ? s_Linear[Texels[Index]] : Texels[Index] / 255.0f;
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static void Encode(ConstPtr<Real32> Input, CPtr<UInt8> Texels, Bool sRGB)
+    {
+        static const Vector<UInt8> s_Encoded = []
+        {
+            Vector<UInt8> Table(k_EncodeSteps);
+
+            for (UInt32 Index = 0; Index < Table.size(); ++Index)
+            {
+                Table[Index] = static_cast<UInt8>(EncodeSRGB(Index / Real32(k_EncodeSteps - 1)) * 255.0f + 0.5f);
+            }
+            return Table;
+        }();
+
+        for (UInt32 Index = 0; Index < Texels.size(); ++Index)
+        {
+            // The Kaiser filter has negative lobes, so values may overshoot slightly.
+            const Real32 Value = Clamp(Input[Index], 0.0f, 1.0f);
+
+            if (sRGB && (Index & 3) != 3)
+            {
+                Texels[Index] = s_Encoded[static_cast<UInt32>(Value * (k_EncodeSteps - 1) + 0.5f)];
+            }
+            else
+            {
+                Texels[Index] = static_cast<UInt8>(Value * 255.0f + 0.5f);
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static void ReduceBox(ConstPtr<Real32> Source, UInt32 Width, UInt32 Height, Ptr<Real32> Target)
+    {
+        const UInt32 TargetWidth  = Max(1u, Width  >> 1);
+        const UInt32 TargetHeight = Max(1u, Height >> 1);
+
+        for (UInt32 Y = 0; Y < TargetHeight; ++Y)
+        {
+            const ConstPtr<Real32> Row0 = Source + (Min(Y * 2,     Height - 1) * Width) * 4;
+            const ConstPtr<Real32> Row1 = Source + (Min(Y * 2 + 1, Height - 1) * Width) * 4;
+
+            for (UInt32 X = 0; X < TargetWidth; ++X)
+            {
+                const UInt32 X0 = Min(X * 2,     Width - 1) * 4;
+                const UInt32 X1 = Min(X * 2 + 1, Width - 1) * 4;
+
+                Lane Texel = ZeroLane();
+                Texel = MultiplyAddLane(Texel, LoadLane(Row0 + X0), 0.25f);
+                Texel = MultiplyAddLane(Texel, LoadLane(Row0 + X1), 0.25f);
+                Texel = MultiplyAddLane(Texel, LoadLane(Row1 + X0), 0.25f);
+                Texel = MultiplyAddLane(Texel, LoadLane(Row1 + X1), 0.25f);
+
+                StoreLane(Target + (Y * TargetWidth + X) * 4, Texel);
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static UInt32 Reflect(SInt32 Index, UInt32 Size)
+    {
+        // Mirror the taps that fall outside the image, so that its edges are not weighted more than its interior.
+        if (Index < 0)
+        {
+            Index = -Index;
+        }
+        else if (Index >= static_cast<SInt32>(Size))
+        {
+            Index = 2 * static_cast<SInt32>(Size) - 2 - Index;
+        }
+        return Clamp<SInt32>(Index, 0, Size - 1);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static void ReduceKaiser(ConstPtr<Real32> Source, UInt32 Width, UInt32 Height, Ptr<Real32> Target)
+    {
+        static const Array<Real32, k_KaiserTaps> s_Weights = CreateKaiserWeights();
+
+        const UInt32 TargetWidth  = Max(1u, Width  >> 1);
+        const UInt32 TargetHeight = Max(1u, Height >> 1);
+
+        // The filter is separable, reduce the rows first and then the columns; an axis of a single texel is
+        // copied as it is.
+        Vector<Real32> Intermediate(TargetWidth * Height * 4);
+
+        for (UInt32 Y = 0; Y < Height; ++Y)
+        {
+            const ConstPtr<Real32> Row = Source + (Y * Width) * 4;
+
+            for (UInt32 X = 0; X < TargetWidth; ++X)
+            {
+                Lane Texel = ZeroLane();
+
+                if (Width == 1)
+                {
+                    Texel = LoadLane(Row);
+                }
+                else
+                {
+                    for (UInt32 Tap = 0; Tap < k_KaiserTaps; ++Tap)
+                    {
+                        const UInt32 Column = Reflect(static_cast<SInt32>(X * 2 + Tap) - 2, Width);
+                        Texel = MultiplyAddLane(Texel, LoadLane(Row + Column * 4), s_Weights[Tap]);
+                    }
+                }
+                StoreLane(Intermediate.data() + (Y * TargetWidth + X) * 4, Texel);
+            }
+        }
+
+        for (UInt32 Y = 0; Y < TargetHeight; ++Y)
+        {
+            for (UInt32 X = 0; X < TargetWidth; ++X)
+            {
+                const ConstPtr<Real32> Column = Intermediate.data() + X * 4;
+
+                Lane Texel = ZeroLane();
+
+                if (Height == 1)
+                {
+                    Texel = LoadLane(Column);
+                }
+                else
+                {
+                    for (UInt32 Tap = 0; Tap < k_KaiserTaps; ++Tap)
+                    {
+                        const UInt32 Row = Reflect(static_cast<SInt32>(Y * 2 + Tap) - 2, Height);
+                        Texel = MultiplyAddLane(Texel, LoadLane(Column + (Row * TargetWidth) * 4), s_Weights[Tap]);
+                    }
+                }
+                StoreLane(Target + (Y * TargetWidth + X) * 4, Texel);
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt8 GetMipmapCount(UInt16 Width, UInt16 Height)
+    {
+        const UInt8 Levels = std::bit_width(static_cast<UInt32>(Max(Width, Height)));
+        return Min<UInt8>(Max<UInt8>(Levels, 1), k_MaxMipmap);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Data GenerateMipmaps(CPtr<const UInt8> Texels, UInt16 Width, UInt16 Height, UInt8 Levels, MipmapFilter Filter, Bool sRGB)
+    {
+        Levels = Min(Levels, GetMipmapCount(Width, Height));
+
+        Data Result(GetTextureSize(TextureFormat::RGBA8UIntNorm, Width, Height, Levels));
+
+        // The first level is the image itself, copy it as it is rather than decoding and encoding it back.
+        std::memcpy(Result.GetData<UInt8>(), Texels.data(), Texels.size());
+
+        GenerateMipmaps(Result.GetData<UInt8>(), Width, Height, Levels, Filter, sRGB);
+        return Result;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void GenerateMipmaps(Ptr<UInt8> Chain, UInt16 Width, UInt16 Height, UInt8 Levels, MipmapFilter Filter, Bool sRGB)
+    {
+        Levels = Min(Levels, GetMipmapCount(Width, Height));
+
+        const CPtr<const UInt8> Texels(Chain, GetTextureSize(TextureFormat::RGBA8UIntNorm, Width, Height));
+        Ptr<UInt8>              Output = Chain + Texels.size();
+
+        // Every level is reduced from the previous one before being quantized, so rounding errors do not accumulate.
+        Vector<Real32> Source(Texels.size());
+        Vector<Real32> Target;
+        Decode(Texels, Source.data(), sRGB);
+
+        for (UInt8 Level = 1; Level < Levels; ++Level)
+        {
+            const UInt16 TargetWidth  = Max<UInt16>(1, Width  >> 1);
+            const UInt16 TargetHeight = Max<UInt16>(1, Height >> 1);
+
+            Target.resize(static_cast<UInt32>(TargetWidth) * TargetHeight * 4);
+
+            switch (Filter)
+            {
+            case MipmapFilter::Box:
+                ReduceBox(Source.data(), Width, Height, Target.data());
+                break;
+            case MipmapFilter::Kaiser:
+                ReduceKaiser(Source.data(), Width, Height, Target.data());
+                break;
+            }
+
+            Encode(Target.data(), CPtr<UInt8>(Output, Target.size()), sRGB);
+            Output += Target.size();
+
+            std::swap(Source, Target);
+            Width  = TargetWidth;
+            Height = TargetHeight;
+        }
+    }
+}
\ No newline at end of file
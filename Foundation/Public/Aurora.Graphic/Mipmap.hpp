@@ -0,0 +1,40 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2025 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Common.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Graphic
+{
+    // Filter used to reduce each level of a mip chain into the next one.
+    enum class MipmapFilter : UInt8
+    {
+        Box,        // Averages every 2x2 block, the cheapest one.
+        Kaiser,     // Kaiser windowed sinc over 6x6 texels, keeps more detail and aliases less.
+    };
+
+    // Returns the number of levels of a complete chain, down to a single texel.
+    UInt8 GetMipmapCount(UInt16 Width, UInt16 Height);
+
+    // Generates the mip chain of an RGBA8 image, packing the levels one after another beginning with the image itself
+    // as expected by \see Texture::Load. sRGB images are filtered in linear space and encoded back afterwards.
+    Data GenerateMipmaps(CPtr<const UInt8> Texels, UInt16 Width, UInt16 Height, UInt8 Levels, MipmapFilter Filter, Bool sRGB);
+
+    // Generates the mip chain in place, the image must already be at the beginning of the chain which has to be large
+    // enough to hold every level as given by \see GetTextureSize.
+    void GenerateMipmaps(Ptr<UInt8> Chain, UInt16 Width, UInt16 Height, UInt8 Levels, MipmapFilter Filter, Bool sRGB);
+}
\ No newline at end of file
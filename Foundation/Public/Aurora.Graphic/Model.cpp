@@ -29,7 +29,7 @@ namespace Graphic
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-    void Model::Load(ConstSPtr<Mesh> Mesh, Any<Array<SPtr<Material>, Mesh::k_MaxPrimitives>> Materials)
+    void Model::Load(ConstSPtr<Mesh> Mesh, Any<Vector<SPtr<Material>>> Materials)
     {
         mMesh      = Mesh;
         mMaterials = Move(Materials);
@@ -32,7 +32,7 @@ namespace Graphic
         Model(Any<Content::Uri> Key);
 
         // -=(Undocumented)=-
-        void Load(ConstSPtr<Mesh> Mesh, Any<Array<SPtr<Material>, Mesh::k_MaxPrimitives>> Materials);
+        void Load(ConstSPtr<Mesh> Mesh, Any<Vector<SPtr<Material>>> Materials);
 
         // -=(Undocumented)=-
         ConstSPtr<Mesh> GetMesh() const
@@ -43,7 +43,7 @@ namespace Graphic
         // -=(Undocumented)=-
         ConstSPtr<Material> GetMaterial(UInt32 Slot) const
         {
-            return mMaterials[Slot];
+            return Slot < mMaterials.size() ? mMaterials[Slot] : nullptr;
         }
 
     private:
@@ -59,7 +59,7 @@ namespace Graphic
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-        SPtr<Mesh>                                   mMesh;         // TODO: Allow to share resource
-        Array<SPtr<Material>, Mesh::k_MaxPrimitives> mMaterials;    // TODO: Allow to share resource
+        SPtr<Mesh>             mMesh;         // TODO: Allow to share resource
+        Vector<SPtr<Material>> mMaterials;    // TODO: Allow to share resource
     };
 }
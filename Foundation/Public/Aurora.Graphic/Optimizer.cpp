@@ -0,0 +1,533 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2025 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Optimizer.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Graphic
+{
+    // Size of the LRU cache Forsyth's algorithm scores vertices against, larger than the one of any device so the
+    // order works well regardless of the actual size.
+    static constexpr UInt32 k_ForsythCacheSize  = 32;
+
+    // Weights of Forsyth's scoring function, as proposed in 'Linear-Speed Vertex Cache Optimisation'.
+    static constexpr Real32 k_CacheDecayPower   = 1.5f;
+    static constexpr Real32 k_LastTriangleScore = 0.75f;
+    static constexpr Real32 k_ValenceBoostScale = 2.0f;
+    static constexpr Real32 k_ValenceBoostPower = 0.5f;
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Real32 GetVertexScore(SInt32 Position, UInt32 Remaining)
+    {
+        if (Remaining == 0)
+        {
+            return -1.0f;
+        }
+
+        Real32 Score = 0.0f;
+
+        if (Position >= 0)
+        {
+            // The vertices of the last triangle score the same, so it is not favoured to be reused in a particular order.
+            if (Position < 3)
+            {
+                Score = k_LastTriangleScore;
+            }
+            else
+            {
+                const Real32 Scale = 1.0f / (k_ForsythCacheSize - 3);
+                Score = std::pow(1.0f - (Position - 3) * Scale, k_CacheDecayPower);
+            }
+        }
+
+        // Boost vertices with few triangles left, so that they are finished off instead of remaining as lonely islands.
+        return Score + k_ValenceBoostScale * std::pow(static_cast<Real32>(Remaining), -k_ValenceBoostPower);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Vector3f GetPosition(VertexStream Positions, UInt32 Vertex)
+    {
+        Real32 Components[3];
+        std::memcpy(Components, Positions.Data.data() + Vertex * Positions.Stride, sizeof(Components));
+        return Vector3f(Components[0], Components[1], Components[2]);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Real32 GetACMR(CPtr<const UInt32> Indices, UInt32 Vertices, UInt32 CacheSize)
+    {
+        const UInt32 Triangles = Indices.size() / 3;
+
+        if (Triangles == 0)
+        {
+            return 0.0f;
+        }
+
+        // A vertex is in the cache while fewer than 'CacheSize' vertices have been pushed after it.
+        Vector<UInt32> Timestamps(Vertices, 0);
+        UInt32         Time   = CacheSize + 1;
+        UInt32         Misses = 0;
+
+        for (const UInt32 Index : Indices)
+        {
+            if (Time - Timestamps[Index] > CacheSize)
+            {
+                Timestamps[Index] = Time++;
+                ++Misses;
+            }
+        }
+        return static_cast<Real32>(Misses) / Triangles;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt32 GenerateVertexRemap(CPtr<UInt32> Remap, CPtr<const UInt32> Indices, CPtr<const VertexStream> Streams)
+    {
+        const auto Hash = [&](UInt32 Vertex)
+        {
+            UInt64 Result = 0;
+
+            for (const VertexStream Stream : Streams)
+            {
+                Result = XXHash64(Stream.Data.subspan(Vertex * Stream.Stride, Stream.Stride), Result);
+            }
+            return Result;
+        };
+
+        const auto Equal = [&](UInt32 Left, UInt32 Right)
+        {
+            for (const VertexStream Stream : Streams)
+            {
+                const ConstPtr<UInt8> Data = Stream.Data.data();
+
+                if (std::memcmp(Data + Left * Stream.Stride, Data + Right * Stream.Stride, Stream.Stride) != 0)
+                {
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        // Open addressing table of the first vertex seen with each set of attributes, kept at most half full.
+        const UInt32   Capacity = std::bit_ceil(Max<UInt32>(Remap.size() * 2, 16));
+        Vector<UInt32> Buckets(Capacity, UINT32_MAX);
+        UInt32         Unique = 0;
+
+        std::fill(Remap.begin(), Remap.end(), UINT32_MAX);
+
+        for (const UInt32 Index : Indices)
+        {
+            if (Remap[Index] != UINT32_MAX)
+            {
+                continue;
+            }
+
+            for (UInt32 Bucket = Hash(Index) & (Capacity - 1);; Bucket = (Bucket + 1) & (Capacity - 1))
+            {
+                if (const UInt32 Vertex = Buckets[Bucket]; Vertex == UINT32_MAX)
+                {
+                    Buckets[Bucket] = Index;
+                    Remap[Index]    = Unique++;
+                    break;
+                }
+                else if (Equal(Vertex, Index))
+                {
+                    Remap[Index] = Remap[Vertex];
+                    break;
+                }
+            }
+        }
+        return Unique;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt32 GenerateFetchRemap(CPtr<UInt32> Remap, CPtr<const UInt32> Indices)
+    {
+        UInt32 Next = 0;
+
+        std::fill(Remap.begin(), Remap.end(), UINT32_MAX);
+
+        for (const UInt32 Index : Indices)
+        {
+            if (Remap[Index] == UINT32_MAX)
+            {
+                Remap[Index] = Next++;
+            }
+        }
+        return Next;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void RemapIndices(CPtr<UInt32> Indices, CPtr<const UInt32> Remap)
+    {
+        for (Ref<UInt32> Index : Indices)
+        {
+            Index = Remap[Index];
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void RemapVertices(CPtr<UInt8> Destination, VertexStream Source, CPtr<const UInt32> Remap)
+    {
+        for (UInt32 Vertex = 0; Vertex < Remap.size(); ++Vertex)
+        {
+            if (const UInt32 Target = Remap[Vertex]; Target != UINT32_MAX)
+            {
+                std::memcpy(
+                    Destination.data() + Target * Source.Stride, Source.Data.data() + Vertex * Source.Stride, Source.Stride);
+            }
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void OptimizeVertexCache(CPtr<UInt32> Indices, UInt32 Vertices)
+    {
+        const UInt32 Triangles = Indices.size() / 3;
+
+        if (Triangles == 0)
+        {
+            return;
+        }
+
+        // Build the list of triangles using each vertex, the live ones are kept at the front of each list.
+        Vector<UInt32> Remaining(Vertices, 0);
+        Vector<UInt32> Offsets(Vertices + 1, 0);
+        Vector<UInt32> Adjacency(Triangles * 3);
+
+        // Trailing indices that do not form a whole triangle are left untouched.
+        for (const UInt32 Index : Indices.first(Triangles * 3))
+        {
+            ++Remaining[Index];
+        }
+        for (UInt32 Vertex = 0; Vertex < Vertices; ++Vertex)
+        {
+            Offsets[Vertex + 1] = Offsets[Vertex] + Remaining[Vertex];
+        }
+
+        Vector<UInt32> Cursor(Offsets.begin(), Offsets.end() - 1);
+
+        for (UInt32 Triangle = 0; Triangle < Triangles; ++Triangle)
+        {
+            for (UInt32 Corner = 0; Corner < 3; ++Corner)
+            {
+                Adjacency[Cursor[Indices[Triangle * 3 + Corner]]++] = Triangle;
+            }
+        }
+
+        // Score every vertex out of the cache and every triangle as the sum of its vertices.
+        Vector<SInt32> Positions(Vertices, -1);
+        Vector<Real32> VertexScores(Vertices);
+        Vector<Real32> TriangleScores(Triangles);
+        Vector<UInt8>  Emitted(Triangles, 0);
+
+        for (UInt32 Vertex = 0; Vertex < Vertices; ++Vertex)
+        {
+            VertexScores[Vertex] = GetVertexScore(-1, Remaining[Vertex]);
+        }
+        for (UInt32 Triangle = 0; Triangle < Triangles; ++Triangle)
+        {
+            TriangleScores[Triangle] = VertexScores[Indices[Triangle * 3]]
+                                     + VertexScores[Indices[Triangle * 3 + 1]]
+                                     + VertexScores[Indices[Triangle * 3 + 2]];
+        }
+
+        Vector<UInt32>                         Output(Triangles * 3);
+        Array<UInt32, k_ForsythCacheSize + 3> Cache;
+        Array<UInt32, k_ForsythCacheSize + 3> Incoming;
+        UInt32                                 CacheCount = 0;
+        UInt32                                 Best       = UINT32_MAX;
+        UInt32                                 Fallback   = 0;
+
+        for (UInt32 Emit = 0; Emit < Triangles; ++Emit)
+        {
+            // When no triangle touches the cache, continue with the next one left in the original order.
+            if (Best == UINT32_MAX)
+            {
+                while (Emitted[Fallback])
+                {
+                    ++Fallback;
+                }
+                Best = Fallback;
+            }
+
+            const ConstPtr<UInt32> Triangle = Indices.data() + Best * 3;
+
+            std::memcpy(Output.data() + Emit * 3, Triangle, sizeof(UInt32) * 3);
+            Emitted[Best] = 1;
+
+            // Push the vertices of the triangle to the front of the cache, keeping the order of the rest.
+            UInt32 IncomingCount = 0;
+
+            for (UInt32 Corner = 0; Corner < 3; ++Corner)
+            {
+                const UInt32 Vertex = Triangle[Corner];
+
+                if (std::find(Incoming.begin(), Incoming.begin() + IncomingCount, Vertex) == Incoming.begin() + IncomingCount)
+                {
+                    Incoming[IncomingCount++] = Vertex;
+                }
+
+                // Drop the triangle from the live ones of the vertex.
+                const Ptr<UInt32> First = Adjacency.data() + Offsets[Vertex];
+                const Ptr<UInt32> Last  = First + Remaining[Vertex];
+                std::swap(* std::find(First, Last, Best), * (Last - 1));
+                --Remaining[Vertex];
+            }
+
+            for (UInt32 Slot = 0; Slot < CacheCount; ++Slot)
+            {
+                const UInt32 Vertex = Cache[Slot];
+
+                if (Vertex != Triangle[0] && Vertex != Triangle[1] && Vertex != Triangle[2])
+                {
+                    Incoming[IncomingCount++] = Vertex;
+                }
+            }
+
+            // Rescore the vertices whose position changed, including the ones just evicted.
+            for (UInt32 Slot = 0; Slot < IncomingCount; ++Slot)
+            {
+                const UInt32 Vertex = Incoming[Slot];
+
+                Positions[Vertex]    = (Slot < k_ForsythCacheSize ? Slot : -1);
+                VertexScores[Vertex] = GetVertexScore(Positions[Vertex], Remaining[Vertex]);
+            }
+
+            // Only the triangles using a vertex in the cache may have changed their score, pick the best among them.
+            Real32 BestScore = -1.0f;
+            Best             = UINT32_MAX;
+
+            for (UInt32 Slot = 0; Slot < IncomingCount; ++Slot)
+            {
+                const UInt32 Vertex = Incoming[Slot];
+
+                for (UInt32 Entry = Offsets[Vertex], Last = Entry + Remaining[Vertex]; Entry < Last; ++Entry)
+                {
+                    const UInt32 Candidate = Adjacency[Entry];
+                    const Real32 Score     = VertexScores[Indices[Candidate * 3]]
+                                           + VertexScores[Indices[Candidate * 3 + 1]]
+                                           + VertexScores[Indices[Candidate * 3 + 2]];
+                    TriangleScores[Candidate] = Score;
+
+                    if (Score > BestScore)
+                    {
+                        BestScore = Score;
+                        Best      = Candidate;
+                    }
+                }
+            }
+
+            CacheCount = Min<UInt32>(IncomingCount, k_ForsythCacheSize);
+            std::copy(Incoming.begin(), Incoming.begin() + CacheCount, Cache.begin());
+        }
+
+        std::copy(Output.begin(), Output.end(), Indices.begin());
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void OptimizeOverdraw(CPtr<UInt32> Indices, VertexStream Positions, Real32 Threshold)
+    {
+        const UInt32 Triangles = Indices.size() / 3;
+        const UInt32 Vertices  = Positions.Data.size() / Positions.Stride;
+
+        if (Triangles == 0)
+        {
+            return;
+        }
+
+        // Simulates the cache over a range of triangles, returning the misses of each one.
+        Vector<UInt32> Timestamps(Vertices, 0);
+        UInt32         Time = k_DefaultCacheSize + 1;
+
+        const auto Simulate = [&](UInt32 Triangle)
+        {
+            UInt32 Misses = 0;
+
+            for (UInt32 Corner = 0; Corner < 3; ++Corner)
+            {
+                if (const UInt32 Index = Indices[Triangle * 3 + Corner]; Time - Timestamps[Index] > k_DefaultCacheSize)
+                {
+                    Timestamps[Index] = Time++;
+                    ++Misses;
+                }
+            }
+            return Misses;
+        };
+
+        const auto Flush = [&]()
+        {
+            Time += k_DefaultCacheSize + 1;
+        };
+
+        // Hard boundaries are the triangles missing all of their vertices, where reordering costs nothing.
+        Vector<UInt32> Hard;
+
+        for (UInt32 Triangle = 0; Triangle < Triangles; ++Triangle)
+        {
+            if (Simulate(Triangle) == 3)
+            {
+                Hard.push_back(Triangle);
+            }
+        }
+        Hard.push_back(Triangles);
+
+        // Split each hard cluster further wherever its ACMR so far is close enough to the one of the whole cluster.
+        Vector<UInt32> Clusters;
+
+        for (UInt32 Cluster = 0; Cluster + 1 < Hard.size(); ++Cluster)
+        {
+            const UInt32 First = Hard[Cluster];
+            const UInt32 Last  = Hard[Cluster + 1];
+
+            UInt32 Misses = 0;
+
+            Flush();
+            for (UInt32 Triangle = First; Triangle < Last; ++Triangle)
+            {
+                Misses += Simulate(Triangle);
+            }
+
+            const Real32 Limit = Threshold * Misses / (Last - First);
+
+            Flush();
+            Clusters.push_back(First);
+
+            for (UInt32 Triangle = First, Start = First, Accumulated = 0; Triangle < Last; ++Triangle)
+            {
+                Accumulated += Simulate(Triangle);
+
+                if (Triangle + 1 < Last && static_cast<Real32>(Accumulated) / (Triangle + 1 - Start) <= Limit)
+                {
+                    Clusters.push_back(Triangle + 1);
+                    Start       = Triangle + 1;
+                    Accumulated = 0;
+                    Flush();
+                }
+            }
+        }
+        Clusters.push_back(Triangles);
+
+        // Sort the clusters by how far their center lies along their normal from the center of the mesh, so the
+        // outermost ones (which occlude the rest) are drawn first.
+        Vector3f Center(0.0f, 0.0f, 0.0f);
+
+        for (UInt32 Vertex = 0; Vertex < Vertices; ++Vertex)
+        {
+            Center += GetPosition(Positions, Vertex);
+        }
+        Center = Center * (1.0f / Max<UInt32>(Vertices, 1));
+
+        const UInt32   Count = Clusters.size() - 1;
+        Vector<Real32> Keys(Count);
+        Vector<UInt32> Order(Count);
+
+        for (UInt32 Cluster = 0; Cluster < Count; ++Cluster)
+        {
+            Vector3f Normal(0.0f, 0.0f, 0.0f);
+            Vector3f Centroid(0.0f, 0.0f, 0.0f);
+            Real32   Area = 0.0f;
+
+            for (UInt32 Triangle = Clusters[Cluster]; Triangle < Clusters[Cluster + 1]; ++Triangle)
+            {
+                const Vector3f A = GetPosition(Positions, Indices[Triangle * 3]);
+                const Vector3f B = GetPosition(Positions, Indices[Triangle * 3 + 1]);
+                const Vector3f C = GetPosition(Positions, Indices[Triangle * 3 + 2]);
+
+                // The cross product is as long as twice the area, which weights each triangle by its size.
+                const Vector3f Cross  = Vector3f::Cross(B - A, C - A);
+                const Real32   Weight = Cross.GetLength();
+
+                Normal   += Cross;
+                Centroid += (A + B + C) * (Weight / 3.0f);
+                Area     += Weight;
+            }
+
+            const Real32 Length = Normal.GetLength();
+
+            Keys[Cluster]  = (Area > 0.0f && Length > 0.0f)
+                ? (Centroid * (1.0f / Area) - Center).Dot(Normal * (1.0f / Length))
+                : 0.0f;
+            Order[Cluster] = Cluster;
+        }
+
+        std::stable_sort(Order.begin(), Order.end(), [&](UInt32 Left, UInt32 Right)
+        {
+            return Keys[Left] > Keys[Right];
+        });
+
+        Vector<UInt32> Output;
+        Output.reserve(Indices.size());
+
+        for (const UInt32 Cluster : Order)
+        {
+            Output.insert(Output.end(), Indices.begin() + Clusters[Cluster] * 3, Indices.begin() + Clusters[Cluster + 1] * 3);
+        }
+        std::copy(Output.begin(), Output.end(), Indices.begin());
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    SInt16 QuantizeSNorm16(Real32 Value)
+    {
+        return static_cast<SInt16>(std::lround(Clamp(Value, -1.0f, 1.0f) * 32767.0f));
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt16 QuantizeHalf(Real32 Value)
+    {
+        const UInt32 Bits     = std::bit_cast<UInt32>(Value);
+        const UInt32 Sign     = (Bits >> 16) & 0x8000;
+        const UInt32 Absolute = Bits & 0x7FFFFFFF;
+
+        // Infinity and NaN keep their class, anything past the largest half rounds to infinity.
+        if (Absolute >= 0x7F800000)
+        {
+            return Sign | 0x7C00 | (Absolute > 0x7F800000 ? 0x0200 : 0);
+        }
+        if (Absolute >= 0x477FF000)
+        {
+            return Sign | 0x7C00;
+        }
+
+        // Below the smallest normal half the value is a multiple of 2^-24, which the float is rounded to.
+        if (Absolute < 0x38800000)
+        {
+            return Sign | static_cast<UInt16>(std::nearbyint(std::bit_cast<Real32>(Absolute) * 16777216.0f));
+        }
+
+        // Rebias the exponent and round the mantissa to the nearest, ties to even.
+        const UInt32 Rounded = Absolute + 0x0FFF + ((Absolute >> 13) & 1);
+        return Sign | ((Rounded - 0x38000000) >> 13);
+    }
+}
\ No newline at end of file
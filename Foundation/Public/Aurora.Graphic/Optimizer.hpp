@@ -0,0 +1,67 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2025 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Common.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Graphic
+{
+    // Number of entries of the FIFO post-transform cache simulated by \see GetACMR, a common size among devices.
+    constexpr UInt32 k_DefaultCacheSize = 16;
+
+    // An attribute of every vertex, packed one vertex after another with 'Stride' bytes each.
+    struct VertexStream
+    {
+        CPtr<const UInt8> Data;
+        UInt32            Stride = 0;
+    };
+
+    // Returns the average number of vertices transformed per triangle (ACMR) of a triangle list through a FIFO cache,
+    // between 0.5 for an ideal order of a large grid and 3 when no vertex is ever reused.
+    Real32 GetACMR(CPtr<const UInt32> Indices, UInt32 Vertices, UInt32 CacheSize = k_DefaultCacheSize);
+
+    // Fills a table mapping each vertex to its new position, where vertices with identical attributes on every stream
+    // share the same position and positions follow the order of first use. Unreferenced vertices map to UINT32_MAX;
+    // returns the number of unique vertices.
+    UInt32 GenerateVertexRemap(CPtr<UInt32> Remap, CPtr<const UInt32> Indices, CPtr<const VertexStream> Streams);
+
+    // Fills a table mapping each vertex to its position in the order in which the indices first reference it, so
+    // that vertices are fetched sequentially. Unreferenced vertices map to UINT32_MAX; returns the vertices used.
+    UInt32 GenerateFetchRemap(CPtr<UInt32> Remap, CPtr<const UInt32> Indices);
+
+    // Rewrites every index through a table produced by \see GenerateVertexRemap or \see GenerateFetchRemap.
+    void RemapIndices(CPtr<UInt32> Indices, CPtr<const UInt32> Remap);
+
+    // Moves every vertex of a stream into the position given by the table, dropping unreferenced vertices.
+    void RemapVertices(CPtr<UInt8> Destination, VertexStream Source, CPtr<const UInt32> Remap);
+
+    // Reorders the triangles so that consecutive ones share vertices, using Forsyth's linear-speed algorithm which
+    // scores each vertex by its position in a simulated LRU cache and the number of triangles still using it.
+    void OptimizeVertexCache(CPtr<UInt32> Indices, UInt32 Vertices);
+
+    // Reorders clusters of a list already optimized by \see OptimizeVertexCache so that the ones facing outwards come
+    // first, which lets depth testing discard more fragments. Clusters are split where the cache would start over and
+    // where their ACMR stays within 'Threshold' times the one of the whole cluster, so larger values allow the cache
+    // efficiency to degrade further in exchange of less overdraw. Positions are three 32-bit floats per vertex.
+    void OptimizeOverdraw(CPtr<UInt32> Indices, VertexStream Positions, Real32 Threshold = 1.05f);
+
+    // Encodes a value within [-1, 1] as a signed normalized 16-bit integer.
+    SInt16 QuantizeSNorm16(Real32 Value);
+
+    // Encodes a value as an IEEE 754 half precision float, rounding to the nearest representable one.
+    UInt16 QuantizeHalf(Real32 Value);
+}
\ No newline at end of file
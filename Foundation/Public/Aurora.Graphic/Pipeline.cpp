@@ -31,11 +31,12 @@ namespace Graphic
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-    void Pipeline::Load(Any<Array<Data, k_MaxStages>> Shaders, Any<Array<TextureSlot, k_MaxSlots>> Slots, Any<Descriptor> Properties)
+    void Pipeline::Load(Any<Array<Data, k_MaxStages>> Shaders, Any<Array<TextureSlot, k_MaxSlots>> Slots, Any<Descriptor> Properties, Any<Data> Cache)
     {
         mShaders    = Move(Shaders);
         mSlots      = Move(Slots);
         mProperties = Move(Properties);
+        mCache      = Move(Cache);
     }
 
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -51,7 +52,8 @@ namespace Graphic
         mID = Context.GetSubsystem<Service>()->CreatePipeline(
             Move(mShaders[0]),
             Move(mShaders[1]),
-            Move(mShaders[2]), mProperties);
+            Move(mShaders[2]),
+            Move(mCache), mProperties);
         return mID > 0;
     }
 
@@ -31,8 +31,8 @@ namespace Graphic
         // -=(Undocumented)=-
         explicit Pipeline(Any<Content::Uri> Key);
 
-        // -=(Undocumented)=-
-        void Load(Any<Array<Data, k_MaxStages>> Shaders, Any<Array<TextureSlot, k_MaxSlots>> Slots, Any<Descriptor> Properties);
+        // Loads the pipeline's stages, along with the entry cached for them by a previous run (if any).
+        void Load(Any<Array<Data, k_MaxStages>> Shaders, Any<Array<TextureSlot, k_MaxSlots>> Slots, Any<Descriptor> Properties, Any<Data> Cache);
 
         // -=(Undocumented)=-
         Object GetID() const
@@ -69,5 +69,6 @@ namespace Graphic
         Array<Data, k_MaxStages>       mShaders;
         Array<TextureSlot, k_MaxSlots> mSlots;
         Descriptor                     mProperties;
+        Data                           mCache;
     };
 }
\ No newline at end of file
@@ -0,0 +1,109 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2025 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "PipelineCache.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Graphic
+{
+    // Magic number that identifies a pipeline binary ('AEPB').
+    static constexpr UInt32 k_PipelineMagic   = 0x42504541;
+
+    // Version of the entry layout, must be bumped whenever 'PipelineHeader' changes.
+    static constexpr UInt32 k_PipelineVersion = 1;
+
+    // -=(Undocumented)=-
+    struct PipelineHeader
+    {
+        UInt32 Magic;
+        UInt32 Version;
+        UInt64 Driver;
+        UInt32 Format;
+        UInt32 Length;
+        UInt32 Checksum;
+        UInt32 Reserved;
+    };
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static UInt64 GetDriverHash(CStr Driver)
+    {
+        return XXHash64(CPtr<const UInt8>(reinterpret_cast<ConstPtr<UInt8>>(Driver.data()), Driver.size()));
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt64 GetPipelineKey(CPtr<const UInt8> Vertex, CPtr<const UInt8> Fragment, CPtr<const UInt8> Geometry, CStr Driver)
+    {
+        // Stages are chained through the seed, so that moving code from one stage to another changes the key as well.
+        UInt64 Hash = GetDriverHash(Driver);
+        Hash = XXHash64(Vertex,   Hash ^ 1);
+        Hash = XXHash64(Fragment, Hash ^ 2);
+        Hash = XXHash64(Geometry, Hash ^ 3);
+        return Hash;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Data EncodePipelineBinary(CStr Driver, UInt32 Format, CPtr<const UInt8> Binary)
+    {
+        PipelineHeader Header;
+        Header.Magic    = k_PipelineMagic;
+        Header.Version  = k_PipelineVersion;
+        Header.Driver   = GetDriverHash(Driver);
+        Header.Format   = Format;
+        Header.Length   = Binary.size();
+        Header.Checksum = CRC32C(Binary);
+        Header.Reserved = 0;
+
+        Data Entry(sizeof(PipelineHeader) + Binary.size());
+        std::memcpy(Entry.GetData<UInt8>(), & Header, sizeof(PipelineHeader));
+        std::memcpy(Entry.GetData<UInt8>() + sizeof(PipelineHeader), Binary.data(), Binary.size());
+        return Entry;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    CPtr<const UInt8> DecodePipelineBinary(CPtr<const UInt8> Entry, CStr Driver, Ref<UInt32> Format)
+    {
+        if (Entry.size() < sizeof(PipelineHeader))
+        {
+            return CPtr<const UInt8>();
+        }
+
+        PipelineHeader Header;
+        std::memcpy(& Header, Entry.data(), sizeof(PipelineHeader));
+
+        const CPtr<const UInt8> Binary = Entry.subspan(sizeof(PipelineHeader));
+
+        // Binaries are only portable across identical drivers, any update to them invalidates every entry.
+        if (Header.Magic    != k_PipelineMagic
+         || Header.Version  != k_PipelineVersion
+         || Header.Driver   != GetDriverHash(Driver)
+         || Header.Length   != Binary.size()
+         || Header.Length   == 0
+         || Header.Checksum != CRC32C(Binary))
+        {
+            return CPtr<const UInt8>();
+        }
+
+        Format = Header.Format;
+        return Binary;
+    }
+}
\ No newline at end of file
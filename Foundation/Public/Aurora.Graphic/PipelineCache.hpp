@@ -0,0 +1,42 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2025 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Common.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Graphic
+{
+    // Storage for the binaries a driver produces when linking a pipeline, so that warm starts skip compiling its
+    // stages. Entries are read by the content pipeline (keyed by \see GetPipelineKey with the driver's identity)
+    // and handed to the driver along with the stages, hence the driver only ever writes to it.
+    struct PipelineCache
+    {
+        // Stores the entry under the given key, replacing any previous one. Invoked from the rendering thread, hence
+        // it must hand the entry off rather than wait for it to be written.
+        FPtr<void(UInt64, CPtr<const UInt8>)> Save;
+    };
+
+    // Returns the key a pipeline is cached under, which changes whenever any of its stages or the driver does.
+    UInt64 GetPipelineKey(CPtr<const UInt8> Vertex, CPtr<const UInt8> Fragment, CPtr<const UInt8> Geometry, CStr Driver);
+
+    // Wraps the binary of a linked pipeline into a cache entry, recording the driver that produced it and its format.
+    Data EncodePipelineBinary(CStr Driver, UInt32 Format, CPtr<const UInt8> Binary);
+
+    // Returns the binary stored in a cache entry along with its format, or an empty span when the entry is truncated,
+    // corrupted, or was written by another version of the engine or by a different driver.
+    CPtr<const UInt8> DecodePipelineBinary(CPtr<const UInt8> Entry, CStr Driver, Ref<UInt32> Format);
+}
\ No newline at end of file
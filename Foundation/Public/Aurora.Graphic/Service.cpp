@@ -72,6 +72,11 @@ namespace Graphic
 
             if (mDriver)
             {
+                // The driver reaches the pipeline cache through this service, which can swap it at any time.
+                mDriver->SetPipelineCache(PipelineCache {
+                    std::bind_front(& Service::OnSavePipeline, this)
+                });
+
                 // Perform a double flush to ensure synchronization between the CPU and GPU.
                 // The first Flush call handles the immediate encoding and begins the process of
                 // transferring data to the GPU. The second Flush ensures that all data has been
@@ -121,6 +126,16 @@ namespace Graphic
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+    void Service::SetPipelineCache(Any<PipelineCache> Cache)
+    {
+        // Waits for any call into the previous storage the rendering thread is making.
+        std::lock_guard Guard(mPipelineMutex);
+        mPipelineCache = Move(Cache);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
     Object Service::CreateBuffer(Usage Type, Bool Immutable, Any<Data> Data)
     {
         const Object ID = mBuffers.Allocate();
@@ -216,7 +231,7 @@ namespace Graphic
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-    Object Service::CreatePipeline(Any<Data> Vertex, Any<Data> Fragment, Any<Data> Geometry, ConstRef<Descriptor> Properties)
+    Object Service::CreatePipeline(Any<Data> Vertex, Any<Data> Fragment, Any<Data> Geometry, Any<Data> Cache, ConstRef<Descriptor> Properties)
     {
         const Object ID = mPipelines.Allocate();
 
@@ -227,6 +242,7 @@ namespace Graphic
             mFrames[k_Default].WriteObject(Vertex);
             mFrames[k_Default].WriteObject(Fragment);
             mFrames[k_Default].WriteObject(Geometry);
+            mFrames[k_Default].WriteObject(Cache);
             mFrames[k_Default].Write(Properties);
         }
         return ID;
@@ -499,9 +515,10 @@ namespace Graphic
             const auto Vertex     = Reader.ReadObject<Data>();
             const auto Fragment   = Reader.ReadObject<Data>();
             const auto Geometry   = Reader.ReadObject<Data>();
+            const auto Cache      = Reader.ReadObject<Data>();
             const auto Properties = Reader.Read<Descriptor>();
 
-            mDriver->CreatePipeline(ID, Vertex, Fragment, Geometry, Properties);
+            mDriver->CreatePipeline(ID, Vertex, Fragment, Geometry, Cache, Properties);
             break;
         }
         case Command::DeletePipeline:
@@ -580,4 +597,16 @@ namespace Graphic
         }
         }
     }
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Service::OnSavePipeline(UInt64 Key, CPtr<const UInt8> Entry)
+    {
+        std::lock_guard Guard(mPipelineMutex);
+
+        if (mPipelineCache.Save)
+        {
+            mPipelineCache.Save(Key, Entry);
+        }
+    }
 }
\ No newline at end of file
@@ -13,6 +13,7 @@
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
 #include "Driver.hpp"
+#include <mutex>
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 // [   CODE   ]
@@ -43,6 +44,10 @@ namespace Graphic
         // -=(Undocumented)=-
         void Reset(UInt16 Width, UInt16 Height, UInt8 Samples);
 
+        // Sets the storage the driver persists linked pipelines to, see \see PipelineCache. Once this returns the
+        // driver no longer reaches the previous storage.
+        void SetPipelineCache(Any<PipelineCache> Cache);
+
         // -=(Undocumented)=-
         Object CreateBuffer(Usage Type, UInt32 Capacity)
         {
@@ -73,8 +78,9 @@ namespace Graphic
         // -=(Undocumented)=-
         void DeletePass(Object ID);
 
-        // -=(Undocumented)=-
-        Object CreatePipeline(Any<Data> Vertex, Any<Data> Fragment, Any<Data> Geometry, ConstRef<Descriptor> Properties);
+        // Creates a pipeline from its stages, along with the entry previously cached for them (if any) so that the
+        // driver can restore the pipeline without compiling them, see \see PipelineCache.
+        Object CreatePipeline(Any<Data> Vertex, Any<Data> Fragment, Any<Data> Geometry, Any<Data> Cache, ConstRef<Descriptor> Properties);
 
         // -=(Undocumented)=-
         void DeletePipeline(Object ID);
@@ -139,6 +145,9 @@ namespace Graphic
         // -=(Undocumented)=-
         void OnExecute(Command Type, Ref<Reader> Reader);
 
+        // -=(Undocumented)=-
+        void OnSavePipeline(UInt64 Key, CPtr<const UInt8> Entry);
+
     private:
 
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -148,6 +157,8 @@ namespace Graphic
         Thread                          mWorker;
         Atomic_Flag                     mBusy;
         Array<Writer, k_InFlightFrames> mFrames;
+        std::mutex                      mPipelineMutex;
+        PipelineCache                   mPipelineCache;
 
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
@@ -22,7 +22,8 @@ namespace Graphic
     // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
     Shader::Shader(Any<Content::Uri> Key)
-        : AbstractResource(Move(Key))
+        : AbstractResource(Move(Key)),
+          mHash { 0 }
     {
     }
 
@@ -30,10 +30,11 @@ namespace Graphic
         // -=(Undocumented)=-
         explicit Shader(Any<Content::Uri> Key);
 
-        // -=(Undocumented)=-
-        void SetBytecode(CStr Bytecode)
+        // Sets the source with every include expanded, along with the hash of all the files it was expanded from.
+        void SetBytecode(CStr Bytecode, UInt64 Hash)
         {
             mBytecode = Bytecode;
+            mHash     = Hash;
         }
 
         // -=(Undocumented)=-
@@ -42,6 +43,13 @@ namespace Graphic
             return mBytecode;
         }
 
+        // Returns the hash of every file the source was expanded from, which identifies the source of any
+        // compilation derived from it.
+        UInt64 GetHash() const
+        {
+            return mHash;
+        }
+
     private:
 
         // \see Resource::OnCreate(Ref<Subsystem::Context>)
@@ -55,6 +63,7 @@ namespace Graphic
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
         // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
-        SStr mBytecode;
+        SStr   mBytecode;
+        UInt64 mHash;
     };
 }
\ No newline at end of file
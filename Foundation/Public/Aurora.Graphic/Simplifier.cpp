@@ -0,0 +1,476 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2025 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Simplifier.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Graphic
+{
+    // Weight of the planes perpendicular to open borders, high enough for borders to keep their silhouette.
+    static constexpr Real64 k_BorderWeight = 10.0;
+
+    // Smallest cosine between a triangle's normal before and after a collapse, below which the collapse is rejected
+    // since it would fold the triangle over its neighbours.
+    static constexpr Real64 k_FlipThreshold = 0.25;
+
+    // -=(Undocumented)=-
+    enum class Kind : UInt8
+    {
+        Manifold,
+        Border,
+        Locked,
+    };
+
+    // A symmetric 4x4 matrix accumulating the squared distance to a set of weighted planes.
+    struct Quadric
+    {
+        Real64 A00 = 0, A11 = 0, A22 = 0, A10 = 0, A20 = 0, A21 = 0;
+        Real64 B0  = 0, B1  = 0, B2  = 0;
+        Real64 C   = 0;
+        Real64 W   = 0;
+    };
+
+    // -=(Undocumented)=-
+    struct Candidate
+    {
+        UInt32 Source;
+        UInt32 Target;
+        Real64 Error;
+    };
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static void Accumulate(Ref<Quadric> Result, ConstRef<Quadric> Other)
+    {
+        Result.A00 += Other.A00;
+        Result.A11 += Other.A11;
+        Result.A22 += Other.A22;
+        Result.A10 += Other.A10;
+        Result.A20 += Other.A20;
+        Result.A21 += Other.A21;
+        Result.B0  += Other.B0;
+        Result.B1  += Other.B1;
+        Result.B2  += Other.B2;
+        Result.C   += Other.C;
+        Result.W   += Other.W;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Quadric GetPlaneQuadric(ConstRef<Vector3f> Normal, ConstRef<Vector3f> Point, Real64 Weight)
+    {
+        const Real64 X = Normal.GetX();
+        const Real64 Y = Normal.GetY();
+        const Real64 Z = Normal.GetZ();
+        const Real64 D = -(X * Point.GetX() + Y * Point.GetY() + Z * Point.GetZ());
+
+        Quadric Result;
+        Result.A00 = Weight * X * X;
+        Result.A11 = Weight * Y * Y;
+        Result.A22 = Weight * Z * Z;
+        Result.A10 = Weight * Y * X;
+        Result.A20 = Weight * Z * X;
+        Result.A21 = Weight * Z * Y;
+        Result.B0  = Weight * D * X;
+        Result.B1  = Weight * D * Y;
+        Result.B2  = Weight * D * Z;
+        Result.C   = Weight * D * D;
+        Result.W   = Weight;
+        return Result;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Real64 GetQuadricError(ConstRef<Quadric> First, ConstRef<Quadric> Second, ConstRef<Vector3f> Point)
+    {
+        Quadric Sum = First;
+        Accumulate(Sum, Second);
+
+        const Real64 X = Point.GetX();
+        const Real64 Y = Point.GetY();
+        const Real64 Z = Point.GetZ();
+
+        const Real64 Error = X * X * Sum.A00 + Y * Y * Sum.A11 + Z * Z * Sum.A22
+                           + 2.0 * (X * Y * Sum.A10 + X * Z * Sum.A20 + Y * Z * Sum.A21)
+                           + 2.0 * (X * Sum.B0 + Y * Sum.B1 + Z * Sum.B2)
+                           + Sum.C;
+
+        // Normalize by the accumulated weight, so the error is the mean squared distance to the original planes.
+        return Sum.W > 0.0 ? Max(Error, 0.0) / Sum.W : 0.0;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static UInt64 GetEdgeKey(UInt32 First, UInt32 Second)
+    {
+        return (static_cast<UInt64>(Min(First, Second)) << 32) | Max(First, Second);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Vector3f GetPosition(VertexStream Positions, UInt32 Vertex)
+    {
+        Real32 Components[3];
+        std::memcpy(Components, Positions.Data.data() + Vertex * Positions.Stride, sizeof(Components));
+        return Vector3f(Components[0], Components[1], Components[2]);
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    UInt32 Simplify(CPtr<UInt32> Destination, CPtr<const UInt32> Indices, VertexStream Positions, UInt32 Target,
+        Real32 Limit, Ref<Real32> Error)
+    {
+        const UInt32 Vertices = Positions.Data.size() / Positions.Stride;
+
+        std::copy(Indices.begin(), Indices.end(), Destination.begin());
+
+        UInt32 Count = Indices.size() - Indices.size() % 3;
+        Error = 0.0f;
+
+        if (Count <= Target)
+        {
+            return Count;
+        }
+
+        // Vertices split by their attributes (a UV seam, a hard normal) share a position, the topology is built over
+        // a single representative of each position so that the split doesn't look like a hole.
+        Vector<UInt32>          Canonical(Vertices);
+        Vector<UInt32>          Wedges(Vertices, 0);
+        Vector<Vector3f>        Points(Vertices);
+        Table<SStr, UInt32>     Unique;
+
+        for (UInt32 Vertex = 0; Vertex < Vertices; ++Vertex)
+        {
+            Points[Vertex] = GetPosition(Positions, Vertex);
+
+            const SStr Key(reinterpret_cast<ConstPtr<char>>(Positions.Data.data() + Vertex * Positions.Stride), 12);
+            Canonical[Vertex] = Unique.try_emplace(Key, Vertex).first->second;
+            ++Wedges[Canonical[Vertex]];
+        }
+
+        // Classify each position by its edges: an edge used by a single triangle is an open border, and an edge used
+        // by more than two makes the surface non-manifold which is never simplified.
+        Table<UInt64, UInt32> Edges;
+
+        const auto CountEdges = [&]()
+        {
+            Edges.clear();
+
+            for (UInt32 Element = 0; Element < Count; Element += 3)
+            {
+                for (UInt32 Corner = 0; Corner < 3; ++Corner)
+                {
+                    const UInt32 First  = Canonical[Destination[Element + Corner]];
+                    const UInt32 Second = Canonical[Destination[Element + (Corner + 1) % 3]];
+
+                    if (First != Second)
+                    {
+                        ++Edges[GetEdgeKey(First, Second)];
+                    }
+                }
+            }
+        };
+        CountEdges();
+
+        Vector<Kind> Kinds(Vertices, Kind::Manifold);
+
+        for (UInt32 Vertex = 0; Vertex < Vertices; ++Vertex)
+        {
+            if (Wedges[Canonical[Vertex]] > 1)
+            {
+                Kinds[Canonical[Vertex]] = Kind::Locked;
+            }
+        }
+
+        for (const auto [Key, Uses] : Edges)
+        {
+            const UInt32 First  = static_cast<UInt32>(Key >> 32);
+            const UInt32 Second = static_cast<UInt32>(Key);
+
+            for (const UInt32 Vertex : { First, Second })
+            {
+                if (Uses > 2)
+                {
+                    Kinds[Vertex] = Kind::Locked;
+                }
+                else if (Uses == 1 && Kinds[Vertex] == Kind::Manifold)
+                {
+                    Kinds[Vertex] = Kind::Border;
+                }
+            }
+        }
+
+        // Accumulate the area-weighted plane of every triangle on its corners, plus a plane perpendicular to each
+        // open border so that collapses along it keep its shape.
+        Vector<Quadric> Quadrics(Vertices);
+
+        for (UInt32 Element = 0; Element < Count; Element += 3)
+        {
+            const UInt32 V0 = Canonical[Destination[Element]];
+            const UInt32 V1 = Canonical[Destination[Element + 1]];
+            const UInt32 V2 = Canonical[Destination[Element + 2]];
+
+            const Vector3f Normal = Vector3f::Cross(Points[V1] - Points[V0], Points[V2] - Points[V0]);
+            const Real32   Area   = Normal.GetLength();
+
+            if (Area <= 0.0f)
+            {
+                continue;
+            }
+
+            const Quadric Plane = GetPlaneQuadric(Normal / Area, Points[V0], Area * 0.5);
+
+            for (const UInt32 Vertex : { V0, V1, V2 })
+            {
+                Accumulate(Quadrics[Vertex], Plane);
+            }
+
+            for (UInt32 Corner = 0; Corner < 3; ++Corner)
+            {
+                const UInt32 First  = Canonical[Destination[Element + Corner]];
+                const UInt32 Second = Canonical[Destination[Element + (Corner + 1) % 3]];
+
+                if (First != Second && Edges[GetEdgeKey(First, Second)] == 1)
+                {
+                    const Vector3f Edge   = Points[Second] - Points[First];
+                    const Vector3f Border = Vector3f::Cross(Edge, Normal / Area);
+                    const Real32   Length = Border.GetLength();
+
+                    if (Length > 0.0f)
+                    {
+                        const Quadric Wall = GetPlaneQuadric(Border / Length, Points[First], Length * k_BorderWeight);
+                        Accumulate(Quadrics[First], Wall);
+                        Accumulate(Quadrics[Second], Wall);
+                    }
+                }
+            }
+        }
+
+        // Collapse in passes: each one sorts every candidate edge by its error and collapses the cheapest ones whose
+        // neighbourhood hasn't been touched yet in the pass, then compacts the index list.
+        const Real64      Threshold = static_cast<Real64>(Limit) * Limit;
+        Real64            Reached   = 0.0;
+        Vector<UInt32>    Collapse(Vertices);
+        Vector<Bool>      Touched(Vertices);
+        Vector<UInt32>    Offsets(Vertices + 1);
+        Vector<UInt32>    Adjacency;
+        Vector<Candidate> Candidates;
+
+        for (UInt32 Pass = 0; Count > Target; ++Pass)
+        {
+            // Edges change as they collapse, so borders are found again on every pass.
+            if (Pass > 0)
+            {
+                CountEdges();
+            }
+
+            // Build the list of triangles around each position.
+            std::fill(Offsets.begin(), Offsets.end(), 0);
+
+            for (UInt32 Element = 0; Element < Count; ++Element)
+            {
+                ++Offsets[Canonical[Destination[Element]] + 1];
+            }
+            for (UInt32 Vertex = 0; Vertex < Vertices; ++Vertex)
+            {
+                Offsets[Vertex + 1] += Offsets[Vertex];
+            }
+
+            Adjacency.resize(Count);
+
+            Vector<UInt32> Cursor(Offsets.begin(), Offsets.end() - 1);
+
+            for (UInt32 Element = 0; Element < Count; ++Element)
+            {
+                Adjacency[Cursor[Canonical[Destination[Element]]]++] = Element / 3;
+            }
+
+            // Gather every directed edge whose source may go away.
+            Candidates.clear();
+
+            for (UInt32 Element = 0; Element < Count; Element += 3)
+            {
+                for (UInt32 Corner = 0; Corner < 3; ++Corner)
+                {
+                    const UInt32 First  = Canonical[Destination[Element + Corner]];
+                    const UInt32 Second = Canonical[Destination[Element + (Corner + 1) % 3]];
+
+                    if (First == Second)
+                    {
+                        continue;
+                    }
+
+                    const Bool IsBorder = (Edges[GetEdgeKey(First, Second)] == 1);
+
+                    for (const auto [Source, Destiny] : { std::pair(First, Second), std::pair(Second, First) })
+                    {
+                        if (Kinds[Source] == Kind::Manifold || (Kinds[Source] == Kind::Border && IsBorder))
+                        {
+                            const Real64 Cost = GetQuadricError(Quadrics[Source], Quadrics[Destiny], Points[Destiny]);
+                            Candidates.push_back({ Source, Destiny, Cost });
+                        }
+                    }
+                }
+            }
+
+            std::ranges::sort(Candidates, {}, & Candidate::Error);
+
+            // Collapse as many edges as needed to reach the target, every interior collapse removes two triangles.
+            for (UInt32 Vertex = 0; Vertex < Vertices; ++Vertex)
+            {
+                Collapse[Vertex] = Vertex;
+                Touched[Vertex]  = false;
+            }
+
+            const UInt32 Goal      = (Count - Target) / 3;
+            UInt32       Removed   = 0;
+            UInt32       Collapses = 0;
+
+            for (ConstRef<Candidate> Edge : Candidates)
+            {
+                if (Edge.Error > Threshold || Removed >= Goal)
+                {
+                    break;
+                }
+                if (Touched[Edge.Source] || Touched[Edge.Target])
+                {
+                    continue;
+                }
+
+                // Reject the collapse when it would fold any of the remaining triangles around the source.
+                Bool   Valid  = true;
+                UInt32 Shared = 0;
+
+                for (UInt32 Slot = Offsets[Edge.Source]; Valid && Slot < Offsets[Edge.Source + 1]; ++Slot)
+                {
+                    const UInt32 Triangle = Adjacency[Slot] * 3;
+                    UInt32       Corners[3];
+
+                    for (UInt32 Corner = 0; Corner < 3; ++Corner)
+                    {
+                        Corners[Corner] = Canonical[Destination[Triangle + Corner]];
+                    }
+
+                    if (Corners[0] == Edge.Target || Corners[1] == Edge.Target || Corners[2] == Edge.Target)
+                    {
+                        ++Shared;
+                        continue;
+                    }
+
+                    const Vector3f Before = Vector3f::Cross(
+                        Points[Corners[1]] - Points[Corners[0]], Points[Corners[2]] - Points[Corners[0]]);
+
+                    for (Ref<UInt32> Corner : Corners)
+                    {
+                        Corner = (Corner == Edge.Source ? Edge.Target : Corner);
+                    }
+
+                    const Vector3f After = Vector3f::Cross(
+                        Points[Corners[1]] - Points[Corners[0]], Points[Corners[2]] - Points[Corners[0]]);
+
+                    const Real64 Scale = static_cast<Real64>(Before.GetLength()) * After.GetLength();
+                    Valid = (Scale > 0.0 && Before.Dot(After) >= k_FlipThreshold * Scale);
+                }
+
+                if (! Valid)
+                {
+                    continue;
+                }
+
+                // Lock the neighbourhood, the triangles around it are stale until the pass ends.
+                for (UInt32 Slot = Offsets[Edge.Source]; Slot < Offsets[Edge.Source + 1]; ++Slot)
+                {
+                    const UInt32 Triangle = Adjacency[Slot] * 3;
+
+                    for (UInt32 Corner = 0; Corner < 3; ++Corner)
+                    {
+                        Touched[Canonical[Destination[Triangle + Corner]]] = true;
+                    }
+                }
+                Touched[Edge.Target] = true;
+
+                Collapse[Edge.Source] = Edge.Target;
+                Accumulate(Quadrics[Edge.Target], Quadrics[Edge.Source]);
+
+                Reached  = Max(Reached, Edge.Error);
+                Removed += Shared;
+                ++Collapses;
+            }
+
+            if (Collapses == 0)
+            {
+                break;
+            }
+
+            // Redirect the collapsed vertices and drop the triangles that became degenerate. The source of a collapse
+            // is never split, so it takes whichever vertex the triangle it shares with the target uses for it.
+            Vector<UInt32> Replacement(Vertices, UINT32_MAX);
+
+            for (UInt32 Element = 0; Element < Count; Element += 3)
+            {
+                for (UInt32 Corner = 0; Corner < 3; ++Corner)
+                {
+                    const UInt32 Vertex = Destination[Element + Corner];
+                    const UInt32 Target = Collapse[Canonical[Vertex]];
+
+                    if (Target != Canonical[Vertex] && Replacement[Vertex] == UINT32_MAX)
+                    {
+                        for (UInt32 Other = 0; Other < 3; ++Other)
+                        {
+                            if (Canonical[Destination[Element + Other]] == Target)
+                            {
+                                Replacement[Vertex] = Destination[Element + Other];
+                            }
+                        }
+                    }
+                }
+            }
+
+            UInt32 Written = 0;
+
+            for (UInt32 Element = 0; Element < Count; Element += 3)
+            {
+                UInt32 Corners[3];
+
+                for (UInt32 Corner = 0; Corner < 3; ++Corner)
+                {
+                    const UInt32 Vertex = Destination[Element + Corner];
+                    Corners[Corner] = (Replacement[Vertex] != UINT32_MAX ? Replacement[Vertex] : Vertex);
+                }
+
+                const UInt32 C0 = Canonical[Corners[0]];
+                const UInt32 C1 = Canonical[Corners[1]];
+                const UInt32 C2 = Canonical[Corners[2]];
+
+                if (C0 != C1 && C1 != C2 && C0 != C2)
+                {
+                    Destination[Written++] = Corners[0];
+                    Destination[Written++] = Corners[1];
+                    Destination[Written++] = Corners[2];
+                }
+            }
+            Count = Written;
+        }
+
+        Error = static_cast<Real32>(std::sqrt(Reached));
+        return Count;
+    }
+}
\ No newline at end of file
@@ -53,7 +53,8 @@ namespace Graphic
 
     Bool Texture::OnCreate(Ref<Subsystem::Context> Context)
     {
-        SetMemory(mData.GetSize()); // TODO: Compressed texture format(s)
+        // Account for the memory the device holds, which for compressed formats is a fraction of the decoded image.
+        SetMemory(GetTextureSize(mFormat, mWidth, mHeight, Max<UInt8>(mLevel, 1)) * mSamples);
 
         mID = Context.GetSubsystem<Service>()->CreateTexture(mFormat, mLayout, mWidth, mHeight, mLevel, mSamples, Move(mData));
 
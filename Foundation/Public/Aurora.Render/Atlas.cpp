@@ -0,0 +1,217 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2025 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Atlas.hpp"
+
+#ifdef    AE_CONTENT_LOADER_STB
+    #include "Aurora.Content/Texture/STB/Loader.hpp"
+#endif // AE_CONTENT_LOADER_STB
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Graphic
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Atlas::Atlas(Ref<Core::Subsystem::Context> Context, CStr Name, Material::Kind Kind, UInt16 Size)
+        : mGraphics { Context.GetSubsystem<Graphic::Service>() },
+          mContent  { Context.GetSubsystem<Content::Service>() },
+          mName     { Name },
+          mKind     { Kind },
+          mSize     { Size }
+    {
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Atlas::~Atlas()
+    {
+        for (Ref<Page> Page : mPages)
+        {
+            mContent->Unload(Page.Material);
+            mContent->Unload(Page.Texture);
+        }
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Atlas::Sprite Atlas::Insert(ConstRef<Content::Uri> Key, CPtr<const UInt8> Texels, UInt16 Width, UInt16 Height)
+    {
+        if (const auto Iterator = mSprites.find(Key.GetId()); Iterator != mSprites.end())
+        {
+            return Iterator->second;
+        }
+
+        if (Width == 0 || Height == 0 || Texels.size() < static_cast<UInt>(Width) * Height * 4)
+        {
+            Log::Warn("Graphics: '{}' ({}x{}) has no texels or too few of them ({} bytes) for '{}'",
+                Key.GetUrl(), Width, Height, Texels.size(), mName);
+            return Sprite();
+        }
+
+        const UInt32 PaddedWidth  = Width  + 2 * k_Padding;
+        const UInt32 PaddedHeight = Height + 2 * k_Padding;
+
+        if (PaddedWidth > mSize || PaddedHeight > mSize)
+        {
+            Log::Warn("Graphics: '{}' ({}x{}) does not fit in a page of '{}'", Key.GetUrl(), Width, Height, mName);
+            return Sprite();
+        }
+
+        // Earlier pages are tried first, so they fill up before a new page is created.
+        Recti Rectangle;
+        Ptr<Page> Target = nullptr;
+
+        for (Ref<Page> Page : mPages)
+        {
+            if (Page.Packer.Insert(PaddedWidth, PaddedHeight, Rectangle))
+            {
+                Target = AddressOf(Page);
+                break;
+            }
+        }
+
+        if (! Target)
+        {
+            Target = AddressOf(Create());
+            Target->Packer.Insert(PaddedWidth, PaddedHeight, Rectangle);
+        }
+
+        // Extrude the edges of the image into the padding, clamping every texel into the image.
+        Data       Chunk(PaddedWidth * PaddedHeight * 4);
+        Ptr<UInt8> Output = Chunk.GetData<UInt8>();
+
+        for (UInt32 Y = 0; Y < PaddedHeight; ++Y)
+        {
+            const UInt32 Row = Clamp<SInt32>(static_cast<SInt32>(Y) - k_Padding, 0, Height - 1);
+
+            for (UInt32 X = 0; X < PaddedWidth; ++X, Output += 4)
+            {
+                const UInt32 Column = Clamp<SInt32>(static_cast<SInt32>(X) - k_Padding, 0, Width - 1);
+                std::memcpy(Output, Texels.data() + (Row * Width + Column) * 4, 4);
+            }
+        }
+
+        mGraphics->UpdateTexture(Target->Texture->GetID(), 0, Rectangle, PaddedWidth * 4, Move(Chunk));
+
+        const Real32 Scale = 1.0f / mSize;
+
+        Sprite Result;
+        Result.Material = Target->Material;
+        Result.UV       = Rectf(
+            (Rectangle.GetLeft()   + k_Padding) * Scale,
+            (Rectangle.GetTop()    + k_Padding) * Scale,
+            (Rectangle.GetRight()  - k_Padding) * Scale,
+            (Rectangle.GetBottom() - k_Padding) * Scale);
+        Result.Width    = Width;
+        Result.Height   = Height;
+
+        mSprites.try_emplace(Key.GetId(), Result);
+        return Result;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#ifdef    AE_CONTENT_LOADER_STB
+
+    Vector<Atlas::Sprite> Atlas::Insert(CPtr<const Content::Uri> Keys)
+    {
+        Vector<Sprite>                    Sprites(Keys.size());
+        Vector<Data>                      Files(Keys.size());
+        Vector<Data>                      Texels(Keys.size());
+        Vector<Content::STBLoader::Image> Images(Keys.size());
+
+        // Only read the images that have not been packed before, the rest are left without a file and skipped.
+        for (UInt32 Index = 0; Index < Keys.size(); ++Index)
+        {
+            if (Sprites[Index] = Find(Keys[Index]); ! Sprites[Index].IsValid())
+            {
+                Files[Index]       = mContent->Find(Keys[Index]);
+                Images[Index].File = Files[Index].GetSpan<const UInt8>();
+            }
+        }
+
+        Content::STBLoader::Decode(* mContent, Images, [&](UInt32 Index, UInt16 Width, UInt16 Height)
+        {
+            Texels[Index] = Data(static_cast<UInt>(Width) * Height * 4);
+            return Texels[Index].GetData<UInt8>();
+        });
+
+        for (UInt32 Index = 0; Index < Keys.size(); ++Index)
+        {
+            if (Sprites[Index].IsValid())
+            {
+                continue;
+            }
+
+            if (ConstRef<Content::STBLoader::Image> Image = Images[Index]; Image.Decoded)
+            {
+                Sprites[Index] = Insert(Keys[Index], Texels[Index].GetSpan<const UInt8>(), Image.Width, Image.Height);
+            }
+            else
+            {
+                Log::Warn("Graphics: '{}' could not be decoded into '{}'", Keys[Index].GetUrl(), mName);
+            }
+        }
+        return Sprites;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#endif // AE_CONTENT_LOADER_STB
+
+    Atlas::Sprite Atlas::Find(ConstRef<Content::Uri> Key) const
+    {
+        const auto Iterator = mSprites.find(Key.GetId());
+        return (Iterator != mSprites.end() ? Iterator->second : Sprite());
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Atlas::Clear()
+    {
+        for (Ref<Page> Page : mPages)
+        {
+            Page.Packer.Reset();
+        }
+        mSprites.clear();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Ref<Atlas::Page> Atlas::Create()
+    {
+        const UInt32 Index = mPages.size();
+
+        // Pages are filled through sub-rectangle uploads, so they are created without any data nor mip chain.
+        SPtr<Texture> Texture = Texture::GetFactory().GetOrCreate(Format("Memory://Atlas/{}/{}.texture", mName, Index), true);
+        Texture->Load(TextureFormat::RGBA8UIntNorm, TextureLayout::Source, mSize, mSize, 1, 1, Data());
+        mContent->Process(Texture, true);
+
+        SPtr<Material> Material = Material::GetFactory().GetOrCreate(Format("Memory://Atlas/{}/{}.material", mName, Index), true);
+        Material->SetKind(mKind);
+        Material->SetSampler(TextureSlot::Diffuse, Sampler(TextureEdge::Clamp, TextureEdge::Clamp, TextureFilter::Bilinear));
+        Material->SetTexture(TextureSlot::Diffuse, Texture);
+        mContent->Process(Material, true);
+
+        return mPages.emplace_back(Page { Move(Texture), Move(Material), Skyline(mSize, mSize) });
+    }
+}
\ No newline at end of file
@@ -0,0 +1,114 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2025 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Skyline.hpp"
+#include "Aurora.Graphic/Material.hpp"
+#include "Aurora.Content/Service.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Graphic
+{
+    // Packs independently loaded sprites into a few shared textures (pages) at runtime, so that sprites living in the
+    // same page share their material and are drawn together by \see Renderer::Flush instead of one batch each.
+    class Atlas final
+    {
+    public:
+
+        // -=(Undocumented)=-
+        static constexpr UInt16 k_DefaultSize = 2048;
+
+        // Texels around every sprite filled with its own edge, so bilinear filtering never reads from its neighbours.
+        static constexpr UInt16 k_Padding     = 1;
+
+        // A sprite packed into one of the pages, drawn with \see Renderer::DrawSprite.
+        struct Sprite
+        {
+            SPtr<Material> Material;
+            Rectf          UV;
+            UInt16         Width  = 0;
+            UInt16         Height = 0;
+
+            // -=(Undocumented)=-
+            Bool IsValid() const
+            {
+                return Material != nullptr;
+            }
+        };
+
+    public:
+
+        // Creates an empty atlas, its pages are named after it and created on demand.
+        Atlas(Ref<Core::Subsystem::Context> Context, CStr Name, Material::Kind Kind = Material::Kind::Normal, UInt16 Size = k_DefaultSize);
+
+        // -=(Undocumented)=-
+        ~Atlas();
+
+        // Packs an RGBA8 image into the first page with room for it, creating a new page if none has, and uploads it
+        // into its place. Inserting a key again returns the sprite already packed; returns an invalid sprite if the
+        // image is empty, has fewer than `Width * Height * 4` bytes of texels, or is larger than a page.
+        Sprite Insert(ConstRef<Content::Uri> Key, CPtr<const UInt8> Texels, UInt16 Width, UInt16 Height);
+
+#ifdef    AE_CONTENT_LOADER_STB
+        // Reads and packs many images at once, such as every sprite of a level; the images are decoded in parallel on
+        // the content worker pool and packed in order. Returns the sprites in the same order as the keys, invalid for
+        // the images that could not be read or decoded.
+        Vector<Sprite> Insert(CPtr<const Content::Uri> Keys);
+#endif // AE_CONTENT_LOADER_STB
+
+        // Returns the sprite packed with the given key, or an invalid sprite if none was.
+        Sprite Find(ConstRef<Content::Uri> Key) const;
+
+        // Forgets every sprite while keeping the pages, which are overwritten by subsequent insertions.
+        void Clear();
+
+        // -=(Undocumented)=-
+        UInt32 GetPageCount() const
+        {
+            return mPages.size();
+        }
+
+    private:
+
+        // -=(Undocumented)=-
+        struct Page
+        {
+            SPtr<Texture>  Texture;
+            SPtr<Material> Material;
+            Skyline        Packer;
+        };
+
+        // -=(Undocumented)=-
+        Ref<Page> Create();
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        SPtr<Service>                   mGraphics;
+        SPtr<Content::Service>          mContent;
+        SStr                            mName;
+        Material::Kind                  mKind;
+        UInt16                          mSize;
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        Vector<Page>                    mPages;
+        Table<Content::AssetId, Sprite> mSprites;
+    };
+}
\ No newline at end of file
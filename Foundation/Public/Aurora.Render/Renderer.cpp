@@ -123,13 +123,13 @@ namespace Graphic
 
     void Renderer::DrawFont(ConstRef<Rectf> Origin, Real32 Depth, CStr16 Text, UInt16 Size, Color Tint, ConstSPtr<Font> Font)
     {
-        const UInt32 ID = Font->GetMaterial()->GetID();
-
         // TODO: Automatically wrapping
         Real32 CurrentX = Origin.GetX();
         Real32 CurrentY = Origin.GetY();
 
-        for (Char16 Previous = 0, Symbol = 0; Symbol < Text.size(); ++Symbol)
+        ConstPtr<Graphic::Font::Glyph> Previous = nullptr;
+
+        for (UInt Symbol = 0; Symbol < Text.size(); ++Symbol)
         {
             const Char16 Codepoint = Text[Symbol];
 
@@ -137,21 +137,30 @@ namespace Graphic
             {
             case '\r':
                 CurrentX = Origin.GetX();
+                Previous = nullptr;
                 break;
             case '\n':
                 CurrentY += Font->GetMetrics().UnderlineHeight * Size;
+                Previous = nullptr;
                 break;
             default:
                 const ConstPtr<Graphic::Font::Glyph> Glyph = Font->GetGlyph(Codepoint);
 
+                if (Glyph == nullptr)
+                {
+                    break;
+                }
+
                 if (Glyph->PlaneBounds.GetWidth() > 0 && Glyph->PlaneBounds.GetHeight() > 0)
                 {
                     const Rectf Boundaries = (Glyph->PlaneBounds * Size) + Vector2f(CurrentX, CurrentY);
 
-                    // TODO: Create a command for all font, not each letter
+                    // Each page has its own material, sorting by it batches the glyphs of every page together.
+                    const Ptr<Material> Page = Font->GetMaterial(Glyph->Page).get();
+
                     // TODO: Calculate Transformation over the origin, not individual
-                    Ref<Command> Command = Create(Type::Font, GetUniqueKey(Font->GetMaterial()->GetKind(), Type::Font, Depth, ID));
-                    Command.Material = Font->GetMaterial().get();
+                    Ref<Command> Command = Create(Type::Font, GetUniqueKey(Page->GetKind(), Type::Font, Depth, Page->GetID()));
+                    Command.Material = Page;
                     Command.Tint     = Tint;
                     Command.Edges[0] = Vector3f(Boundaries.GetLeft(),  Boundaries.GetBottom(), Depth);
                     Command.Edges[1] = Vector3f(Boundaries.GetRight(), Boundaries.GetBottom(), Depth);
@@ -160,9 +169,9 @@ namespace Graphic
                     Command.UV       = Glyph->ImageBounds;
                 }
                 CurrentX += (Font->GetKerning(Previous, Codepoint) + Glyph->Advance) * Size;
+                Previous = Glyph;
                 break;
             }
-            Previous = Codepoint;
         }
     }
 
@@ -171,13 +180,13 @@ namespace Graphic
 
     void Renderer::DrawFont(ConstRef<Matrix4f> Transform, ConstRef<Rectf> Origin, Real32 Depth, CStr16 Text, UInt16 Size, Color Tint, ConstSPtr<Font> Font)
     {
-        const UInt32 ID = Font->GetMaterial()->GetID();
-
         // TODO: Automatically wrapping
         Real32 CurrentX = Origin.GetX();
         Real32 CurrentY = Origin.GetY();
 
-        for (Char16 Previous = 0, Symbol = 0; Symbol < Text.size(); ++Symbol)
+        ConstPtr<Graphic::Font::Glyph> Previous = nullptr;
+
+        for (UInt Symbol = 0; Symbol < Text.size(); ++Symbol)
         {
             const Char16 Codepoint = Text[Symbol];
 
@@ -185,21 +194,30 @@ namespace Graphic
             {
             case '\r':
                 CurrentX = Origin.GetX();
+                Previous = nullptr;
                 break;
             case '\n':
                 CurrentY += Font->GetMetrics().UnderlineHeight * Size;
+                Previous = nullptr;
                 break;
             default:
                 const ConstPtr<Graphic::Font::Glyph> Glyph = Font->GetGlyph(Codepoint);
 
+                if (Glyph == nullptr)
+                {
+                    break;
+                }
+
                 if (Glyph->PlaneBounds.GetWidth() > 0 && Glyph->PlaneBounds.GetHeight() > 0)
                 {
                     const Rectf Boundaries = (Glyph->PlaneBounds * Size) + Vector2f(CurrentX, CurrentY);
 
-                    // TODO: Create a command for all font, not each letter
+                    // Each page has its own material, sorting by it batches the glyphs of every page together.
+                    const Ptr<Material> Page = Font->GetMaterial(Glyph->Page).get();
+
                     // TODO: Calculate Transformation over the origin, not individual
-                    Ref<Command> Command = Create(Type::Font, GetUniqueKey(Font->GetMaterial()->GetKind(), Type::Font, Depth, ID));
-                    Command.Material = Font->GetMaterial().get();
+                    Ref<Command> Command = Create(Type::Font, GetUniqueKey(Page->GetKind(), Type::Font, Depth, Page->GetID()));
+                    Command.Material = Page;
                     Command.Tint     = Tint;
                     Command.Edges[0] = Transform * Vector3f(Boundaries.GetLeft(),  Boundaries.GetBottom(), Depth);
                     Command.Edges[1] = Transform * Vector3f(Boundaries.GetRight(), Boundaries.GetBottom(), Depth);
@@ -208,9 +226,9 @@ namespace Graphic
                     Command.UV       = Glyph->ImageBounds;
                 }
                 CurrentX += (Font->GetKerning(Previous, Codepoint) + Glyph->Advance) * Size;
+                Previous = Glyph;
                 break;
             }
-            Previous = Codepoint;
         }
     }
 
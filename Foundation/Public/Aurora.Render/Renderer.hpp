@@ -12,6 +12,7 @@
 // [  HEADER  ]
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 
+#include "Atlas.hpp"
 #include "Heap.hpp"
 #include "Aurora.Graphic/Camera.hpp"
 #include "Aurora.Graphic/Encoder.hpp"
@@ -106,6 +107,18 @@ namespace Graphic
         // -=(Undocumented)=-
         void DrawSprite(ConstRef<Matrix4f> Transform, ConstRef<Rectf> Origin, Real32 Depth, ConstRef<Rectf> UV, Color Tint, ConstSPtr<Material> Material);
 
+        // Draws a sprite packed into an atlas, sprites sharing a page share its material and are batched together.
+        void DrawSprite(ConstRef<Rectf> Origin, Real32 Depth, ConstRef<Atlas::Sprite> Sprite, Color Tint)
+        {
+            DrawSprite(Origin, Depth, Sprite.UV, Tint, Sprite.Material);
+        }
+
+        // -=(Undocumented)=-
+        void DrawSprite(ConstRef<Matrix4f> Transform, ConstRef<Rectf> Origin, Real32 Depth, ConstRef<Atlas::Sprite> Sprite, Color Tint)
+        {
+            DrawSprite(Transform, Origin, Depth, Sprite.UV, Tint, Sprite.Material);
+        }
+
         // -=(Undocumented)=-
         void DrawFont(ConstRef<Rectf> Origin, Real32 Depth, CStr16 Text, UInt16 Size, Color Tint, ConstSPtr<Font> Font);
 
@@ -0,0 +1,164 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2025 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Skyline.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Graphic
+{
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Skyline::Skyline(UInt16 Width, UInt16 Height)
+        : mWidth  { Width },
+          mHeight { Height },
+          mUsed   { 0 }
+    {
+        Reset();
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Skyline::Reset()
+    {
+        mUsed = 0;
+        mSegments.clear();
+        mSegments.push_back(Segment { 0, 0, mWidth });
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    Bool Skyline::Insert(UInt16 Width, UInt16 Height, Ref<Recti> Result)
+    {
+        UInt32 BestIndex  = UINT32_MAX;
+        SInt32 BestTop    = INT32_MAX;
+        UInt16 BestWidth  = UINT16_MAX;
+        SInt32 BestY      = 0;
+
+        for (UInt32 Index = 0; Index < mSegments.size(); ++Index)
+        {
+            const SInt32 Y = Fit(Index, Width, Height);
+
+            if (Y < 0)
+            {
+                continue;
+            }
+
+            // Prefer the lowest top edge, and among those the narrowest segment so wide ones remain for wide rectangles.
+            const SInt32 Top = Y + Height;
+
+            if (Top < BestTop || (Top == BestTop && mSegments[Index].Width < BestWidth))
+            {
+                BestIndex = Index;
+                BestTop   = Top;
+                BestWidth = mSegments[Index].Width;
+                BestY     = Y;
+            }
+        }
+
+        if (BestIndex == UINT32_MAX)
+        {
+            return false;
+        }
+
+        const UInt16 X = mSegments[BestIndex].X;
+
+        // Raise the skyline over the rectangle, then trim or drop the segments it now covers.
+        mSegments.insert(mSegments.begin() + BestIndex, Segment { X, static_cast<UInt16>(BestTop), Width });
+
+        for (UInt32 Index = BestIndex + 1; Index < mSegments.size();)
+        {
+            ConstRef<Segment> Previous = mSegments[Index - 1];
+            Ref<Segment>      Current  = mSegments[Index];
+
+            const UInt32 End = Previous.X + Previous.Width;
+
+            if (Current.X >= End)
+            {
+                break;
+            }
+
+            const UInt32 Overlap = End - Current.X;
+
+            if (Overlap < Current.Width)
+            {
+                Current.X     += Overlap;
+                Current.Width -= Overlap;
+                break;
+            }
+            mSegments.erase(mSegments.begin() + Index);
+        }
+
+        Merge();
+
+        mUsed += static_cast<UInt32>(Width) * Height;
+        Result.Set(X, BestY, X + Width, BestY + Height);
+        return true;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    SInt32 Skyline::Fit(UInt32 Index, UInt16 Width, UInt16 Height) const
+    {
+        const UInt32 X = mSegments[Index].X;
+
+        if (X + Width > mWidth)
+        {
+            return -1;
+        }
+
+        // The rectangle rests on the highest segment it spans.
+        SInt32 Y = 0;
+
+        for (UInt32 Remaining = Width; Remaining > 0; ++Index)
+        {
+            if (Index == mSegments.size())
+            {
+                return -1;
+            }
+
+            Y = Max<SInt32>(Y, mSegments[Index].Y);
+
+            if (Y + Height > mHeight)
+            {
+                return -1;
+            }
+            Remaining -= Min<UInt32>(Remaining, mSegments[Index].Width);
+        }
+        return Y;
+    }
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    void Skyline::Merge()
+    {
+        for (UInt32 Index = 1; Index < mSegments.size();)
+        {
+            if (mSegments[Index - 1].Y == mSegments[Index].Y)
+            {
+                mSegments[Index - 1].Width += mSegments[Index].Width;
+                mSegments.erase(mSegments.begin() + Index);
+            }
+            else
+            {
+                ++Index;
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2025 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#pragma once
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include "Aurora.Math/Rect.hpp"
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Graphic
+{
+    // Packs rectangles into a fixed area keeping track of the top edge of every column span, each rectangle is placed
+    // where its top ends the lowest (the bottom-left rule) which keeps the wasted space under the skyline small.
+    class Skyline final
+    {
+    public:
+
+        // -=(Undocumented)=-
+        Skyline(UInt16 Width, UInt16 Height);
+
+        // Forgets every rectangle packed so far.
+        void Reset();
+
+        // Finds room for a rectangle of the given size, returns false if it does not fit anywhere.
+        Bool Insert(UInt16 Width, UInt16 Height, Ref<Recti> Result);
+
+        // -=(Undocumented)=-
+        UInt16 GetWidth() const
+        {
+            return mWidth;
+        }
+
+        // -=(Undocumented)=-
+        UInt16 GetHeight() const
+        {
+            return mHeight;
+        }
+
+        // Returns the fraction of the area covered by rectangles.
+        Real32 GetOccupancy() const
+        {
+            return static_cast<Real32>(mUsed) / (static_cast<Real32>(mWidth) * mHeight);
+        }
+
+    private:
+
+        // -=(Undocumented)=-
+        struct Segment
+        {
+            UInt16 X;
+            UInt16 Y;
+            UInt16 Width;
+        };
+
+        // Returns the height at which a rectangle starting at the given segment rests, or -1 if it does not fit.
+        SInt32 Fit(UInt32 Index, UInt16 Width, UInt16 Height) const;
+
+        // -=(Undocumented)=-
+        void Merge();
+
+    private:
+
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+        // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+        UInt16          mWidth;
+        UInt16          mHeight;
+        UInt32          mUsed;
+        Vector<Segment> mSegments;
+    };
+}
\ No newline at end of file
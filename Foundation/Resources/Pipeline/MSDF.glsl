@@ -0,0 +1,70 @@
+// Parameters
+
+layout(std140) uniform Global0
+{
+    mat4 u_Camera;
+};
+
+layout(std140) uniform Material2
+{
+    vec2  u_Dimension;
+    float u_Distance;
+};
+
+#ifdef STAGE_VERTEX
+
+// Attributes
+
+layout(location = 0) in vec3 a_Position;
+layout(location = 1) in vec2 a_Texture;
+layout(location = 2) in vec4 a_Color;
+
+out vec2 v_Texture;
+out vec4 v_Color;
+
+// VS Main
+
+void vertex()
+{
+    gl_Position = u_Camera * vec4(a_Position.xyz, 1.0);
+    v_Texture   = a_Texture;
+    v_Color     = a_Color;
+}
+
+#endif // STAGE_VERTEX
+
+#ifdef STAGE_FRAGMENT
+
+// Resources
+
+uniform sampler2D ColorTexture0;
+
+// Attributes
+
+in vec2 v_Texture;
+in vec4 v_Color;
+
+layout(location = 0) out vec4 o_Target;
+
+// PS Main
+
+float Median(vec3 Color)
+{
+    return max(min(Color.r, Color.g), min(max(Color.r, Color.g), Color.b));
+}
+
+void fragment()
+{
+    vec3  Sample        = texture(ColorTexture0, v_Texture).rgb;
+    float Distance      = Median(Sample) - 0.5;
+    float DistanceAlpha = abs(dFdx(Distance)) + abs(dFdy(Distance));
+    float Alpha         = clamp(Distance / DistanceAlpha + 0.5, 0.0, 1.0);
+
+    if (Alpha <= 0.01)
+    {
+        discard;
+    }
+    o_Target = vec4(v_Color.rgb, v_Color.a * Alpha);
+}
+
+#endif // STAGE_FRAGMENT
\ No newline at end of file
@@ -0,0 +1,40 @@
+// Parameters
+
+layout(std140) uniform Global0
+{
+    mat4 u_Camera;
+};
+
+#ifdef STAGE_VERTEX
+
+// Attributes
+
+layout(location = 0) in vec3 a_Position;
+layout(location = 1) in vec4 a_Color;
+
+out vec4 v_Color;
+
+// VS Main
+
+void vertex()
+{
+    gl_Position = u_Camera * vec4(a_Position.xyz, 1.0);
+    v_Color     = a_Color;
+}
+
+#endif // STAGE_VERTEX
+
+#ifdef STAGE_FRAGMENT
+
+in vec4 v_Color;
+
+layout(location = 0) out vec4 o_Target;
+
+// PS Main
+
+void fragment()
+{
+    o_Target = v_Color;
+}
+
+#endif // STAGE_FRAGMENT
\ No newline at end of file
@@ -0,0 +1,50 @@
+// Parameters
+
+layout(std140) uniform Global0
+{
+    mat4 u_Camera;
+};
+
+#ifdef STAGE_VERTEX
+
+// Attributes
+
+layout(location = 0) in vec2 a_Position;
+layout(location = 1) in vec2 a_Texture;
+layout(location = 2) in vec4 a_Color;
+
+out vec2 v_Texture;
+out vec4 v_Color;
+
+// VS Main
+
+void vertex()
+{
+    gl_Position = u_Camera * vec4(a_Position.xy, 0.0, 1.0);
+    v_Texture   = a_Texture;
+    v_Color     = a_Color;
+}
+
+#endif // STAGE_VERTEX
+
+#ifdef STAGE_FRAGMENT
+
+// Resources
+
+uniform sampler2D ColorTexture0;
+
+// Attributes
+
+in vec2 v_Texture;
+in vec4 v_Color;
+
+layout(location = 0) out vec4 o_Target;
+
+// PS Main
+
+void fragment()
+{
+    o_Target = v_Color * texture(ColorTexture0, v_Texture);
+}
+
+#endif // STAGE_FRAGMENT
\ No newline at end of file
@@ -0,0 +1,128 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2025 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include <Aurora.Graphic/PipelineCache.hpp>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// Offsets of the entry's header fields, as laid out by 'EncodePipelineBinary'.
+static constexpr UInt k_MagicOffset   = 0;
+static constexpr UInt k_VersionOffset = 4;
+static constexpr UInt k_LengthOffset  = 20;
+static constexpr UInt k_HeaderSize    = 32;
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+static Bool Check(Bool Condition, CStr Name)
+{
+    if (! Condition)
+    {
+        Log::Error("PipelineCache: '{}' failed", Name);
+    }
+    return Condition;
+}
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+static Bool IsRejected(CPtr<const UInt8> Entry, CStr Driver)
+{
+    UInt32 Format = 0;
+    return Graphic::DecodePipelineBinary(Entry, Driver, Format).empty();
+}
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+static Data Corrupt(ConstRef<Data> Entry, UInt Offset)
+{
+    Data Copy(Entry.GetSize());
+    Copy.Copy(Entry.GetData<UInt8>(), Entry.GetSize());
+    Copy.GetData<UInt8>()[Offset] ^= 0xFF;
+    return Copy;
+}
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+static Bool TestRoundTrip()
+{
+    const UInt8 Binary[] = { 0xDE, 0xAD, 0xBE, 0xEF, 0x01, 0x02, 0x03, 0x04, 0x05 };
+
+    const Data Entry = Graphic::EncodePipelineBinary("Vendor|Renderer|1.0", 0x8741, Binary);
+
+    UInt32 Format = 0;
+    const CPtr<const UInt8> Result = Graphic::DecodePipelineBinary(Entry.GetSpan<UInt8>(), "Vendor|Renderer|1.0", Format);
+
+    Bool Successful = true;
+    Successful &= Check(Entry.GetSize() == k_HeaderSize + sizeof(Binary), "Entry size");
+    Successful &= Check(Format == 0x8741, "Round trip format");
+    Successful &= Check(Result.size() == sizeof(Binary), "Round trip length");
+    Successful &= Check(std::equal(Result.begin(), Result.end(), Binary), "Round trip content");
+    return Successful;
+}
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+static Bool TestRejection()
+{
+    const UInt8 Binary[] = { 0x10, 0x20, 0x30, 0x40, 0x50, 0x60, 0x70, 0x80 };
+    const CStr  Driver   = "Vendor|Renderer|1.0";
+
+    const Data Entry = Graphic::EncodePipelineBinary(Driver, 1, Binary);
+    const CPtr<const UInt8> Bytes = Entry.GetSpan<UInt8>();
+
+    // An entry whose length field disagrees with its payload, while the payload (and its checksum) stays intact.
+    Data Length = Corrupt(Entry, k_LengthOffset);
+
+    Bool Successful = true;
+    Successful &= Check(!IsRejected(Bytes, Driver), "Intact entry");
+    Successful &= Check(IsRejected(Corrupt(Entry, k_MagicOffset).GetSpan<UInt8>(), Driver), "Bad magic");
+    Successful &= Check(IsRejected(Corrupt(Entry, k_VersionOffset).GetSpan<UInt8>(), Driver), "Bad version");
+    Successful &= Check(IsRejected(Bytes, "Vendor|Renderer|1.1"), "Bad driver");
+    Successful &= Check(IsRejected(Length.GetSpan<UInt8>(), Driver), "Bad length");
+    Successful &= Check(IsRejected(Bytes.first(Bytes.size() - 1), Driver), "Truncated payload");
+    Successful &= Check(IsRejected(Bytes.first(k_HeaderSize - 1), Driver), "Truncated header");
+    Successful &= Check(IsRejected(Corrupt(Entry, k_HeaderSize + 3).GetSpan<UInt8>(), Driver), "Bad checksum");
+    Successful &= Check(IsRejected(Graphic::EncodePipelineBinary(Driver, 1, { }).GetSpan<UInt8>(), Driver), "Empty binary");
+    return Successful;
+}
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+static Bool TestKey()
+{
+    const UInt8 Vertex[]   = { 'v', 'e', 'r', 't', 'e', 'x' };
+    const UInt8 Fragment[] = { 'f', 'r', 'a', 'g' };
+    const UInt8 Other[]    = { 'f', 'r', 'a', 'h' };
+
+    const UInt64 Key = Graphic::GetPipelineKey(Vertex, Fragment, { }, "Driver");
+
+    Bool Successful = true;
+    Successful &= Check(Key == Graphic::GetPipelineKey(Vertex, Fragment, { }, "Driver"), "Stable key");
+    Successful &= Check(Key != Graphic::GetPipelineKey(Vertex, Other, { }, "Driver"), "Key follows stages");
+    Successful &= Check(Key != Graphic::GetPipelineKey(Vertex, Fragment, { }, "Driver 2"), "Key follows driver");
+    Successful &= Check(Key != Graphic::GetPipelineKey(Vertex, { }, Fragment, "Driver"), "Key follows stage order");
+    return Successful;
+}
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   MAIN   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+int main(int Argc, Ptr<Char> Argv[])
+{
+    Bool Successful = true;
+    Successful &= TestRoundTrip();
+    Successful &= TestRejection();
+    Successful &= TestKey();
+    return Successful ? 0 : 1;
+}
\ No newline at end of file
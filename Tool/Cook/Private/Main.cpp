@@ -0,0 +1,130 @@
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// Copyright (C) 2021-2025 by Agustin Alvarez. All rights reserved.
+//
+// This work is licensed under the terms of the MIT license.
+//
+// For a copy, see <https://opensource.org/licenses/MIT>.
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [  HEADER  ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+#include <Aurora.Content/Service.hpp>
+#include <Aurora.Content/Locator/SystemLocator.hpp>
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   CODE   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+namespace Cook
+{
+    // Schema under which the source directory is mounted.
+    static constexpr CStr k_SourceSchema = "Source";
+
+    // -=(Undocumented)=-
+    struct Summary
+    {
+        UInt32 Cooked  = 0;
+        UInt32 Skipped = 0;
+        UInt32 Failed  = 0;
+    };
+
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+    // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+    static Bool Walk(Ref<Content::Service> Service, ConstRef<SStr> Root, ConstRef<SStr> Folder, Ref<Summary> Summary)
+    {
+        Vector<SStr> Children;
+
+        const auto OnEnumerate = [](Ptr<void> User, ConstPtr<Char> Directory, ConstPtr<Char> Name)
+        {
+            static_cast<Ptr<Vector<SStr>>>(User)->emplace_back(Name);
+            return SDL_ENUM_CONTINUE;
+        };
+
+        if (! SDL_EnumerateDirectory(Format("{}{}", Root, Folder).c_str(), OnEnumerate, & Children))
+        {
+            Log::Warn("Cook: Failed to enumerate '{}{}'", Root, Folder);
+            return false;
+        }
+
+        std::sort(Children.begin(), Children.end());
+
+        for (ConstRef<SStr> Child : Children)
+        {
+            const SStr Path = Folder.empty() ? Child : Format("{}/{}", Folder, Child);
+
+            SDL_PathInfo Information;
+
+            if (! SDL_GetPathInfo(Format("{}{}", Root, Path).c_str(), & Information))
+            {
+                continue;
+            }
+
+            if (Information.type == SDL_PATHTYPE_DIRECTORY)
+            {
+                Walk(Service, Root, Path, Summary);
+            }
+            else if (Information.type == SDL_PATHTYPE_FILE)
+            {
+                const Content::Uri Key(Format("{}://{}", k_SourceSchema, Path));
+
+                if (! Service.HasLoader(Key.GetExtension()))
+                {
+                    ++Summary.Skipped;
+                }
+                else if (Service.Cook(Key))
+                {
+                    ++Summary.Cooked;
+                }
+                else
+                {
+                    ++Summary.Failed;
+                }
+            }
+        }
+        return true;
+    }
+}
+
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+// [   MAIN   ]
+// -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
+
+int main(int Argc, Ptr<Char> Argv[])
+{
+    if (Argc != 3)
+    {
+        Log::Info("Usage: {} <Source Directory> <Cache Directory>", Argv[0]);
+        return 1;
+    }
+
+    SStr Root(Argv[1]);
+
+    if (! Root.ends_with('/') && ! Root.ends_with('\\'))
+    {
+        Root.push_back('/');
+    }
+
+    // Mount the source directory, and the directory where the decoded form of every asset is stored.
+    if (! SDL_CreateDirectory(Argv[2]))
+    {
+        Log::Warn("Cook: Failed to create '{}'", Argv[2]);
+        return 1;
+    }
+
+    Subsystem::Context Context;
+
+    ConstSPtr<Content::Service> Service = Context.AddSubsystem<Content::Service>();
+    Service->AddLocator(Cook::k_SourceSchema, NewPtr<Content::SystemLocator>(Root));
+    Service->AddLocator(Content::Service::k_CacheSchema, NewPtr<Content::SystemLocator>(Argv[2]));
+
+    Cook::Summary Summary;
+    const Bool    Result = Cook::Walk(* Service, Root, "", Summary);
+
+    Service->OnDispose();
+
+    Log::Info("Cook: {} cooked, {} skipped, {} failed", Summary.Cooked, Summary.Skipped, Summary.Failed);
+    return (Result && Summary.Failed == 0 ? 0 : 1);
+}
\ No newline at end of file